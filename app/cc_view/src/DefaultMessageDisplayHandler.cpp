@@ -17,12 +17,15 @@
 
 #include "DefaultMessageDisplayHandler.h"
 
+#include <algorithm>
 #include <cassert>
+#include <typeinfo>
 
 #include <QtWidgets/QApplication>
 
 #include "cc_tools_qt/ToolsField.h"
 #include "cc_tools_qt/ToolsFieldHandler.h"
+#include "cc_tools_qt/property/message.h"
 #include "widget/field/IntValueFieldWidget.h"
 #include "widget/field/UnsignedLongLongIntValueFieldWidget.h"
 #include "widget/field/BitmaskValueFieldWidget.h"
@@ -134,20 +137,21 @@ public:
     virtual void handle(field::ToolsArrayListField& field) override
     {
         auto createMembersWidgetsFunc =
-            [](field::ToolsArrayListField& fieldParam) -> std::vector<FieldWidgetPtr>
+            [](field::ToolsArrayListField& fieldParam, unsigned from, unsigned count) -> std::vector<FieldWidgetPtr>
             {
                 std::vector<FieldWidgetPtr> allFieldsWidgets;
                 WidgetCreator otherCreator;
                 auto& members = fieldParam.getMembers();
-                allFieldsWidgets.reserve(members.size());
                 assert(members.size() == fieldParam.size());
+                assert((from + count) <= members.size());
+                allFieldsWidgets.reserve(count);
 
-                for (auto& mem : members) {
-                    mem->dispatch(otherCreator);
+                for (auto idx = from; idx < (from + count); ++idx) {
+                    members[idx]->dispatch(otherCreator);
                     allFieldsWidgets.push_back(otherCreator.getWidget());
                 }
 
-                assert(allFieldsWidgets.size() == fieldParam.size());
+                assert(allFieldsWidgets.size() == count);
                 return allFieldsWidgets;
             };
 
@@ -212,12 +216,55 @@ private:
 };
 
 
+const std::size_t MaxCachedMsgWidgets = 64U;
 
 }  // namespace
 
 DefaultMessageDisplayHandler::~DefaultMessageDisplayHandler() noexcept = default;
 
-DefaultMessageDisplayHandler::MsgWidgetPtr DefaultMessageDisplayHandler::getMsgWidget(ToolsMessage& msg)
+MessageWidget* DefaultMessageDisplayHandler::getCachedMsgWidget(ToolsMessagePtr msg)
+{
+    assert(msg);
+    ++m_useCount;
+    auto key = CacheKey(std::type_index(typeid(*msg)), msg->numericId(), property::message::ToolsMsgIdx().getFrom(*msg));
+    auto iter = m_cache.find(key);
+    if (iter != m_cache.end()) {
+        auto& elem = iter->second;
+        assert(elem.m_widget);
+        elem.m_lastUse = m_useCount;
+        if (elem.m_widget->rebind(*msg)) {
+            elem.m_msg = std::move(msg);
+            return elem.m_widget.get();
+        }
+
+        m_cache.erase(iter);
+    }
+
+    if (MaxCachedMsgWidgets <= m_cache.size()) {
+        auto lruIter =
+            std::min_element(
+                m_cache.begin(), m_cache.end(),
+                [](Cache::const_reference elem1, Cache::const_reference elem2)
+                {
+                    return elem1.second.m_lastUse < elem2.second.m_lastUse;
+                });
+        assert(lruIter != m_cache.end());
+        m_cache.erase(lruIter);
+    }
+
+    auto& elem = m_cache[key];
+    elem.m_widget = createMsgWidget(*msg);
+    elem.m_msg = std::move(msg);
+    elem.m_lastUse = m_useCount;
+    return elem.m_widget.get();
+}
+
+void DefaultMessageDisplayHandler::clearCache()
+{
+    m_cache.clear();
+}
+
+DefaultMessageDisplayHandler::DefaultMsgWidgetPtr DefaultMessageDisplayHandler::createMsgWidget(ToolsMessage& msg)
 {
     auto widget = std::make_unique<DefaultMessageWidget>(msg);
 
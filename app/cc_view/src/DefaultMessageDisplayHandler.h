@@ -19,7 +19,11 @@
 #pragma once
 
 #include <cassert>
+#include <map>
+#include <memory>
+#include <tuple>
 #include <type_traits>
+#include <typeindex>
 
 #include <QtWidgets/QVBoxLayout>
 
@@ -34,11 +38,31 @@ namespace cc_tools_qt
 class DefaultMessageDisplayHandler
 {
 public:
-    using MsgWidgetPtr = std::unique_ptr<MessageWidget>;
-
     ~DefaultMessageDisplayHandler() noexcept;
 
-    static MsgWidgetPtr getMsgWidget(ToolsMessage& msg);
+    // The widget created for the message of the same type before is rebound
+    // to the fields of the provided message, the returned widget remains
+    // owned by the handler. The message is kept alive while its widget is
+    // cached as the field widgets refer to its fields.
+    MessageWidget* getCachedMsgWidget(ToolsMessagePtr msg);
+    void clearCache();
+
+private:
+    using DefaultMsgWidgetPtr = std::unique_ptr<DefaultMessageWidget>;
+    using CacheKey = std::tuple<std::type_index, qlonglong, unsigned>;
+
+    struct CacheElem
+    {
+        ToolsMessagePtr m_msg; // Outlives the widget bound to it
+        DefaultMsgWidgetPtr m_widget;
+        unsigned long long m_lastUse = 0U;
+    };
+
+    static DefaultMsgWidgetPtr createMsgWidget(ToolsMessage& msg);
+
+    using Cache = std::map<CacheKey, CacheElem>;
+    Cache m_cache;
+    unsigned long long m_useCount = 0U;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,180 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "FieldsFilterWorker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <utility>
+
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const std::size_t MaxBatchSize = 256U;
+
+struct PendingMsg
+{
+    FieldsFilterWorker::MsgNumberType m_msgNum = 0U;
+    ToolsMessagePtr m_msg;
+};
+
+} // namespace
+
+struct FieldsFilterWorker::InnerState
+{
+    void run(FieldsFilterWorker& worker);
+
+    QMutex m_mutex;
+    QWaitCondition m_cond;
+    std::deque<PendingMsg> m_queue;
+    ToolsMsgPredicate m_filter;
+    ResultsList m_results;
+    bool m_stopRequested = false;
+
+    // Checked by the background thread between the messages
+    std::atomic<unsigned> m_generation{0U};
+
+    std::unique_ptr<QThread> m_thread;
+};
+
+void FieldsFilterWorker::InnerState::run(FieldsFilterWorker& worker)
+{
+    std::vector<PendingMsg> batch;
+    ResultsList batchResults;
+    ToolsMsgPredicate filter;
+    unsigned filterGeneration = 0U;
+    while (true) {
+        m_mutex.lock();
+        while (m_queue.empty() && (!m_stopRequested)) {
+            m_cond.wait(&m_mutex);
+        }
+
+        if (m_stopRequested) {
+            m_mutex.unlock();
+            break;
+        }
+
+        auto generation = m_generation.load();
+        if (generation != filterGeneration) {
+            filter = m_filter;
+            filterGeneration = generation;
+        }
+
+        auto count = std::min(m_queue.size(), MaxBatchSize);
+        auto batchEnd = m_queue.begin() + static_cast<std::ptrdiff_t>(count);
+        batch.assign(std::make_move_iterator(m_queue.begin()), std::make_move_iterator(batchEnd));
+        m_queue.erase(m_queue.begin(), batchEnd);
+        m_mutex.unlock();
+
+        batchResults.clear();
+        for (auto& pending : batch) {
+            if (m_generation.load() != generation) {
+                break;
+            }
+
+            assert(pending.m_msg);
+            batchResults.push_back(Result{pending.m_msgNum, filter.matches(*pending.m_msg)});
+        }
+
+        // The messages are released by the background thread
+        batch.clear();
+
+        bool notify = false;
+        {
+            QMutexLocker lock(&m_mutex);
+            if (m_generation.load() != generation) {
+                continue;
+            }
+
+            notify = m_results.empty();
+            m_results.insert(m_results.end(), batchResults.begin(), batchResults.end());
+        }
+
+        // The owner is notified once until all the results are taken
+        if (notify) {
+            emit worker.sigResultsReady();
+        }
+    }
+}
+
+FieldsFilterWorker::FieldsFilterWorker(QObject* parentObj) :
+    Base(parentObj),
+    m_state(std::make_unique<InnerState>())
+{
+    m_state->m_thread.reset(
+        QThread::create(
+            [this]()
+            {
+                m_state->run(*this);
+            }));
+    m_state->m_thread->start(QThread::LowPriority);
+}
+
+FieldsFilterWorker::~FieldsFilterWorker() noexcept
+{
+    {
+        QMutexLocker lock(&m_state->m_mutex);
+        m_state->m_stopRequested = true;
+        ++m_state->m_generation;
+        m_state->m_queue.clear();
+    }
+
+    m_state->m_cond.wakeAll();
+    m_state->m_thread->wait();
+}
+
+void FieldsFilterWorker::setFilter(const ToolsMsgPredicate& filter)
+{
+    QMutexLocker lock(&m_state->m_mutex);
+    ++m_state->m_generation;
+    m_state->m_filter = filter;
+    m_state->m_queue.clear();
+    m_state->m_results.clear();
+}
+
+void FieldsFilterWorker::addMsg(MsgNumberType msgNum, ToolsMessagePtr msg)
+{
+    assert(msg);
+    {
+        QMutexLocker lock(&m_state->m_mutex);
+        m_state->m_queue.push_back(PendingMsg{msgNum, std::move(msg)});
+    }
+
+    m_state->m_cond.wakeOne();
+}
+
+FieldsFilterWorker::ResultsList FieldsFilterWorker::takeResults()
+{
+    ResultsList results;
+    QMutexLocker lock(&m_state->m_mutex);
+    results.swap(m_state->m_results);
+    return results;
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,70 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QObject>
+
+#include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgMgr.h"
+#include "cc_tools_qt/ToolsMsgPredicate.h"
+
+namespace cc_tools_qt
+{
+
+// Evaluates the fields filter on the persistent background thread.
+// The queued messages are only read, the results are collected in the
+// order of queueing and taken by the owner thread when notified by the
+// (queued) sigResultsReady() signal. Setting the new filter cancels the
+// evaluation in progress and drops the queued messages and the not yet
+// taken results.
+class FieldsFilterWorker : public QObject
+{
+    Q_OBJECT
+    using Base = QObject;
+
+public:
+    using MsgNumberType = ToolsMsgMgr::MsgNumberType;
+
+    struct Result
+    {
+        MsgNumberType m_msgNum = 0U;
+        bool m_matches = false;
+    };
+
+    using ResultsList = std::vector<Result>;
+
+    explicit FieldsFilterWorker(QObject* parentObj = nullptr);
+    ~FieldsFilterWorker() noexcept;
+
+    void setFilter(const ToolsMsgPredicate& filter);
+    void addMsg(MsgNumberType msgNum, ToolsMessagePtr msg);
+    ResultsList takeResults();
+
+signals:
+    void sigResultsReady();
+
+private:
+    struct InnerState;
+    std::unique_ptr<InnerState> m_state;
+};
+
+}  // namespace cc_tools_qt
@@ -18,7 +18,10 @@
 
 #include "GuiAppMgr.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <limits>
 #include <memory>
 
 #include <QtCore/QTimer>
@@ -42,6 +45,9 @@ namespace
 {
 
 const QString AppDataStorageFileName("startup_config.json");
+const qlonglong DenseFilteredIdsLimit = 0x10000;
+const unsigned DenseFilteredIdxsLimit = 8U;
+const std::size_t FieldsFilterFeedChunkSize = 1024U;
 
 QString getConfigPath(const QString& configName)
 {
@@ -113,6 +119,10 @@ bool GuiAppMgr::startFromFile(const QString& filename)
 void GuiAppMgr::msgCommentUpdated(ToolsMessagePtr msg)
 {
     assert(msg == m_clickedMsg);
+    if (m_selType == SelectionType::Recv) {
+        MsgMgrG::instanceRef().updateMsgComment(*msg);
+    }
+
     emit sigMsgCommentUpdated(std::move(msg));
 }
 
@@ -128,22 +138,56 @@ void GuiAppMgr::setFilteredMessages(FilteredMessages&& filteredMessages)
     }
     
     m_filteredMessages = std::move(filteredMessages);
+    updateFilteredIds();
+    updateRecvIdFlags();
 
     if (recvListApplyFilter()) {
         refreshRecvList();
     }
 }
 
+const QString& GuiAppMgr::getFieldsFilter() const
+{
+    return m_fieldsFilter.expression();
+}
+
+void GuiAppMgr::setFieldsFilter(const QString& expr)
+{
+    if (expr == m_fieldsFilter.expression()) {
+        return;
+    }
+
+    [[maybe_unused]] bool compiled = m_fieldsFilter.compile(expr);
+    assert(compiled); // Expected to be validated by the dialog
+
+    updateRecvFieldsFlags();
+}
+
 QString GuiAppMgr::messageDesc(const ToolsMessage& msg)
 {
     return QString("(%1) %2").arg(msg.idAsString()).arg(msg.name());
 }
 
+QString GuiAppMgr::messageDesc(const ToolsProtocol::MsgCatalogEntry& entry)
+{
+    return QString("(%1) %2").arg(entry.m_idAsString).arg(entry.m_name);
+}
+
 void GuiAppMgr::setDebugOutputLevel(unsigned level)
 {
     m_debugOutputLevel = level;
 }
 
+unsigned GuiAppMgr::getMsgListUpdateRate() const
+{
+    return m_msgListUpdateRate;
+}
+
+void GuiAppMgr::setMsgListUpdateRate(unsigned rate)
+{
+    m_msgListUpdateRate = rate;
+}
+
 void GuiAppMgr::pluginsEditClicked()
 {
     emit sigPluginsEditDialog();
@@ -195,6 +239,7 @@ void GuiAppMgr::recvDeleteClicked()
     assert(m_selType == SelectionType::Recv);
     assert(m_clickedMsg);
 
+    eraseRecvMsgsInfo(ToolsMsgMgr::MsgNumbersList(1U, ToolsMsgMgr::getMsgNumber(*m_clickedMsg)));
     MsgMgrG::instanceRef().deleteMsg(m_clickedMsg);
 
     clearDisplayedMessage();
@@ -233,6 +278,28 @@ void GuiAppMgr::recvApplyFilterToggled(bool checked)
     updateRecvListMode(RecvListMode_ApplyFilter, checked);
 }
 
+void GuiAppMgr::recvSearchRequested(const QString& query)
+{
+    auto trimmedQuery = query.trimmed();
+    if (trimmedQuery.isEmpty() && (!recvListSearchActive())) {
+        return;
+    }
+
+    ToolsMsgMgr::MsgNumbersList results;
+    if (!trimmedQuery.isEmpty()) {
+        QString error;
+        if (!MsgMgrG::instanceRef().searchMsgs(trimmedQuery, results, error)) {
+            emit sigErrorReported(error);
+            return;
+        }
+    }
+
+    m_searchQuery = std::move(trimmedQuery);
+    m_searchResults = std::move(results);
+    emit sigRecvListTitleNeedsUpdate();
+    refreshRecvList();
+}
+
 void GuiAppMgr::sendStartClicked()
 {
     m_sendState = SendState::SendingSingle;
@@ -245,9 +312,20 @@ void GuiAppMgr::sendStartAllClicked()
     emitSendStateUpdate();
 }
 
+void GuiAppMgr::sendStartLoadClicked()
+{
+    emit sigLoadGeneratorDialog();
+}
+
+void GuiAppMgr::sendStartReplayClicked()
+{
+    emit sigReplayDialog();
+}
+
 void GuiAppMgr::sendStopClicked()
 {
     m_sendState = SendState::Idle;
+    m_sendAllMode = SendAllMode::Regular;
     m_sendMgr.stop();
     emitSendStateUpdate();
 }
@@ -433,6 +511,7 @@ void GuiAppMgr::recvLoadMsgsFromFile(const QString& filename)
 
     clearRecvList(false);
     msgMgr.deleteAllMsgs();
+    clearRecvMsgsInfo();
 
     msgMgr.addMsgs(msgs);
 }
@@ -467,6 +546,11 @@ unsigned GuiAppMgr::recvListModeMask() const
     return m_recvListMode;
 }
 
+bool GuiAppMgr::recvListSearchActive() const
+{
+    return !m_searchQuery.isEmpty();
+}
+
 GuiAppMgr::SendState GuiAppMgr::sendState() const
 {
     return m_sendState;
@@ -534,22 +618,63 @@ void GuiAppMgr::sendUpdateList(const ToolsMessagesList& msgs)
     }
 }
 
-void GuiAppMgr::deleteMessages(ToolsMessagesList&& msgs)
+void GuiAppMgr::deleteMessages(ToolsMsgMgr::MsgNumbersList&& msgNums)
 {
     auto& msgMgr = MsgMgrG::instanceRef();
-    if (msgMgr.getAllMsgs().size() == msgs.size()) {
+    if (msgMgr.getMsgsCount() == msgNums.size()) {
         msgMgr.deleteAllMsgs();
+        clearRecvMsgsInfo();
         return;
     }
 
-    msgMgr.deleteMsgs(msgs);
+    std::sort(msgNums.begin(), msgNums.end());
+    eraseRecvMsgsInfo(msgNums);
+    msgMgr.deleteMsgs(msgNums);
 }
 
 void GuiAppMgr::sendMessages(ToolsMessagesList&& msgs)
 {
+    if (m_sendAllMode == SendAllMode::Load) {
+        m_sendMgr.startLoad(MsgMgrG::instanceRef().getProtocol(), msgs, m_loadConfig);
+        return;
+    }
+
+    if (m_sendAllMode == SendAllMode::Replay) {
+        m_sendMgr.startReplay(MsgMgrG::instanceRef().getProtocol(), msgs, m_replayConfig);
+        return;
+    }
+
     m_sendMgr.start(MsgMgrG::instanceRef().getProtocol(), std::move(msgs));
 }
 
+void GuiAppMgr::sendStartLoad(const LoadConfig& config)
+{
+    assert(m_sendState == SendState::Idle);
+    m_loadConfig = config;
+    m_sendAllMode = SendAllMode::Load;
+    m_sendState = SendState::SendingAll;
+    emitSendStateUpdate();
+}
+
+const GuiAppMgr::LoadConfig& GuiAppMgr::sendLoadConfig() const
+{
+    return m_loadConfig;
+}
+
+void GuiAppMgr::sendStartReplay(const ReplayConfig& config)
+{
+    assert(m_sendState == SendState::Idle);
+    m_replayConfig = config;
+    m_sendAllMode = SendAllMode::Replay;
+    m_sendState = SendState::SendingAll;
+    emitSendStateUpdate();
+}
+
+const GuiAppMgr::ReplayConfig& GuiAppMgr::sendReplayConfig() const
+{
+    return m_replayConfig;
+}
+
 GuiAppMgr::ActivityState GuiAppMgr::getActivityState()
 {
     auto& pluginMgr = PluginMgrG::instanceRef();
@@ -586,6 +711,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         if (needsReload) {
             clearRecvList(false);
             msgMgr.deleteAllMsgs();
+            clearRecvMsgsInfo();
         }
 
         msgMgr.stop();
@@ -671,7 +797,11 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         msgMgr.addFilter(std::move(filter));
     }
 
+    // The reapplied plugins may change the protocol definition
+    applyInfo.m_protocol->invalidateMsgCatalog();
     msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    updateFilteredIds();
+    updateRecvIdFlags();
 
     msgMgr.start();
     emit sigActivityStateChanged(static_cast<int>(ActivityState::Active));
@@ -700,6 +830,23 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
         &m_pendingDisplayTimer, SIGNAL(timeout()),
         this, SLOT(pendingDisplayTimeout()));
 
+    m_recvListCountTimer.setSingleShot(true);
+
+    connect(
+        &m_recvListCountTimer, SIGNAL(timeout()),
+        this, SLOT(reportRecvListCount()));
+
+    m_fieldsFilterFeedTimer.setInterval(0);
+
+    connect(
+        &m_fieldsFilterFeedTimer, SIGNAL(timeout()),
+        this, SLOT(feedFieldsFilter()));
+
+    connect(
+        &m_fieldsFilterWorker, SIGNAL(sigResultsReady()),
+        this, SLOT(fieldsFilterResultsReady()),
+        Qt::QueuedConnection);
+
     m_sendMgr.setSendMsgsCallbackFunc(
         [](ToolsMessagesList&& msgsToSend)
         {
@@ -712,6 +859,18 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
             sendStopClicked();
         });
 
+    m_sendMgr.setLoadStatsReportCallbackFunc(
+        [this](const ToolsMsgSendMgr::LoadStats& stats)
+        {
+            loadStatsReported(stats);
+        });
+
+    m_sendMgr.setReplayStatsReportCallbackFunc(
+        [this](const ToolsMsgSendMgr::ReplayStats& stats)
+        {
+            replayStatsReported(stats);
+        });
+
     auto& msgMgr = MsgMgrG::instanceRef();
     msgMgr.setMsgAddedCallbackFunc(
         [this](ToolsMessagePtr msg)
@@ -734,6 +893,40 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
     refreshRecvState();
 }
 
+void GuiAppMgr::loadStatsReported(const ToolsMsgSendMgr::LoadStats& stats)
+{
+    unsigned long long backlog = 0U;
+    auto socket = MsgMgrG::instanceRef().getSocket();
+    if (socket) {
+        backlog = socket->sendBacklog();
+    }
+
+    auto msg =
+        tr("Sent %1 msgs (%2 bytes) in %3 sec: %4 msg/sec, %5 bytes/sec; queued: %6 msgs; socket backlog: %7 bytes")
+            .arg(stats.m_sentMsgs)
+            .arg(stats.m_sentBytes)
+            .arg(static_cast<double>(stats.m_elapsedMs) / 1000.0, 0, 'f', 1)
+            .arg(stats.m_msgsRate, 0, 'f', 1)
+            .arg(stats.m_bytesRate, 0, 'f', 1)
+            .arg(stats.m_queueDepth)
+            .arg(backlog);
+
+    emit sigSendStatsReport(msg);
+}
+
+void GuiAppMgr::replayStatsReported(const ToolsMsgSendMgr::ReplayStats& stats)
+{
+    auto msg =
+        tr("Replayed %1 of %2 msgs in %3 sec; behind schedule: %4 ms (max %5 ms)")
+            .arg(stats.m_sentMsgs)
+            .arg(stats.m_totalMsgs)
+            .arg(static_cast<double>(stats.m_elapsedMs) / 1000.0, 0, 'f', 1)
+            .arg(stats.m_lagMs)
+            .arg(stats.m_maxLagMs);
+
+    emit sigSendStatsReport(msg);
+}
+
 void GuiAppMgr::emitRecvStateUpdate()
 {
     emit sigSetRecvState(static_cast<int>(m_recvState));
@@ -763,10 +956,28 @@ void GuiAppMgr::msgAdded(ToolsMessagePtr msg)
     std::cout << '[' << property::message::ToolsMsgTimestamp().getFrom(*msg) << "] " << prefix << msg->name() << std::endl;
 #endif
 
-    if (!canAddToRecvList(*msg, type)) {
+    storeRecvMsgInfo(msg, type);
+
+    // The list displays the search results only
+    if (recvListSearchActive()) {
         return;
     }
 
+    // Keep the order of the messages awaiting the fields filter result
+    if ((!m_deferredRecvMsgs.empty()) || isRecvFieldsPending(m_recvMsgsInfo.back())) {
+        m_deferredRecvMsgs.push_back(std::move(msg));
+        return;
+    }
+
+    if (!isRecvListVisible(m_recvMsgsInfo.back())) {
+        return;
+    }
+
+    showAddedMsg(std::move(msg));
+}
+
+void GuiAppMgr::showAddedMsg(ToolsMessagePtr msg)
+{
     addMsgToRecvList(msg);
 
     if (m_clickedMsg) {
@@ -790,6 +1001,77 @@ void GuiAppMgr::errorReported(const QString& msg)
     emit sigErrorReported(msg + tr("\nThe tool may not work properly!"));
 }
 
+void GuiAppMgr::feedFieldsFilter()
+{
+    // The messages are resolved (decoded in the compact mode) in chunks,
+    // one chunk per event loop iteration.
+    auto& msgMgr = MsgMgrG::instanceRef();
+    assert(msgMgr.getMsgsCount() == m_recvMsgsInfo.size());
+    auto iter = recvMsgInfoLowerBound(m_fieldsFilterFeedNext);
+    std::size_t count = 0U;
+    for (; (iter != m_recvMsgsInfo.end()) && (iter->m_msgNum < m_fieldsFilterFeedEnd); ++iter) {
+        if (FieldsFilterFeedChunkSize <= count) {
+            m_fieldsFilterFeedNext = iter->m_msgNum;
+            return;
+        }
+
+        if ((iter->m_flags & RecvMsgFlag_Garbage) != 0U) {
+            continue;
+        }
+
+        auto msg = msgMgr.getMsg(static_cast<std::size_t>(std::distance(m_recvMsgsInfo.begin(), iter)));
+        if (!msg) {
+            continue;
+        }
+
+        m_fieldsFilterWorker.addMsg(iter->m_msgNum, std::move(msg));
+        m_fieldsFilterLastFed = iter->m_msgNum;
+        m_fieldsFilterFed = true;
+        ++count;
+    }
+
+    m_fieldsFilterFeedTimer.stop();
+    if (m_fieldsFilterFed) {
+        return;
+    }
+
+    m_fieldsFilterRefreshPending = false;
+    if (recvListApplyFilter()) {
+        refreshRecvList();
+    }
+}
+
+void GuiAppMgr::fieldsFilterResultsReady()
+{
+    bool completed = false;
+    auto results = m_fieldsFilterWorker.takeResults();
+    for (auto& result : results) {
+        auto iter = recvMsgInfoLowerBound(result.m_msgNum);
+        if ((iter != m_recvMsgsInfo.end()) && (iter->m_msgNum == result.m_msgNum)) {
+            iter->m_flags &= static_cast<std::uint8_t>(~(RecvMsgFlag_FieldsMismatch | RecvMsgFlag_FieldsPending));
+            if (!result.m_matches) {
+                iter->m_flags |= RecvMsgFlag_FieldsMismatch;
+            }
+        }
+
+        if (m_fieldsFilterRefreshPending &&
+            (!m_fieldsFilterFeedTimer.isActive()) &&
+            (result.m_msgNum == m_fieldsFilterLastFed)) {
+            completed = true;
+        }
+    }
+
+    if (completed) {
+        m_fieldsFilterRefreshPending = false;
+        if (recvListApplyFilter()) {
+            refreshRecvList();
+            return;
+        }
+    }
+
+    flushDeferredRecvMsgs();
+}
+
 void GuiAppMgr::pendingDisplayTimeout()
 {
     m_pendingDisplayWaitInProgress = false;
@@ -817,6 +1099,11 @@ void GuiAppMgr::msgClicked(ToolsMessagePtr msg, SelectionType selType)
 void GuiAppMgr::displayMessage(ToolsMessagePtr msg)
 {
     m_pendingDisplayMsg.reset();
+    auto protocol = MsgMgrG::instanceRef().getProtocol();
+    if (msg && protocol) {
+        protocol->createExtraInfoMsgIfNeeded(*msg);
+    }
+
     emit sigDisplayMsg(msg);
 }
 
@@ -842,31 +1129,117 @@ void GuiAppMgr::refreshRecvList()
 
     clearRecvList(false);
 
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
-    for (auto& msg : allMsgs) {
-        assert(msg);
-        auto type = property::message::ToolsMsgType().getFrom(*msg);
+    // Only the numbers of the visible messages are passed to the list,
+    // the messages are resolved (decoded in the compact mode) when displayed.
+    ToolsMsgMgr::MsgNumbersList msgNums;
+
+    // The deferred messages are added when their fields filter results arrive
+    auto endMsgNum = std::numeric_limits<ToolsMsgMgr::MsgNumberType>::max();
+    if (!m_deferredRecvMsgs.empty()) {
+        endMsgNum = ToolsMsgMgr::getMsgNumber(*m_deferredRecvMsgs.front());
+    }
 
-        if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
-            if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, static_cast<int>(m_recvListCount) - 1);
+    if (recvListSearchActive()) {
+        // Both are sorted by the message number
+        auto infoIter = m_recvMsgsInfo.begin();
+        for (auto msgNum : m_searchResults) {
+            if (endMsgNum <= msgNum) {
+                break;
+            }
+
+            infoIter =
+                std::lower_bound(
+                    infoIter, m_recvMsgsInfo.end(), msgNum,
+                    [](const RecvMsgInfo& info, ToolsMsgMgr::MsgNumberType num)
+                    {
+                        return info.m_msgNum < num;
+                    });
+
+            if (infoIter == m_recvMsgsInfo.end()) {
+                break;
+            }
+
+            if ((infoIter->m_msgNum == msgNum) && isRecvListVisible(*infoIter)) {
+                msgNums.push_back(msgNum);
+            }
+        }
+    }
+    else {
+        for (auto& info : m_recvMsgsInfo) {
+            if (endMsgNum <= info.m_msgNum) {
+                break;
+            }
+
+            if (isRecvListVisible(info)) {
+                msgNums.push_back(info.m_msgNum);
             }
         }
     }
 
+    int selectedIdx = -1;
+    if (clickedMsg && (m_selType != SelectionType::Send)) {
+        auto clickedMsgNum = ToolsMsgMgr::getMsgNumber(*clickedMsg);
+        auto numIter = std::lower_bound(msgNums.begin(), msgNums.end(), clickedMsgNum);
+        if ((numIter != msgNums.end()) && (*numIter == clickedMsgNum)) {
+            selectedIdx = static_cast<int>(std::distance(msgNums.begin(), numIter));
+        }
+    }
+
+    m_recvListCount = static_cast<decltype(m_recvListCount)>(msgNums.size());
+    reportRecvListCount();
+    emit sigRecvListReset(msgNums, selectedIdx);
+
+    if (0 <= selectedIdx) {
+        recvMsgClicked(std::move(clickedMsg), selectedIdx);
+    }
+
     if (!m_clickedMsg) {
         emit sigRecvMsgListClearSelection();
     }
+
+    flushDeferredRecvMsgs();
 }
 
 void GuiAppMgr::addMsgToRecvList(ToolsMessagePtr msg)
 {
     assert(msg);
     ++m_recvListCount;
-    emit sigRecvListCountReport(m_recvListCount);
     emit sigAddRecvMsg(msg);
+
+    // The count is reported once per batch of the added messages
+    if (m_msgListUpdateRate == 0U) {
+        reportRecvListCount();
+        return;
+    }
+
+    if (!m_recvListCountTimer.isActive()) {
+        static const unsigned MsInSec = 1000U;
+        m_recvListCountTimer.start(static_cast<int>(std::max(1U, MsInSec / m_msgListUpdateRate)));
+    }
+}
+
+void GuiAppMgr::flushDeferredRecvMsgs()
+{
+    while (!m_deferredRecvMsgs.empty()) {
+        auto msgNum = ToolsMsgMgr::getMsgNumber(*m_deferredRecvMsgs.front());
+        auto iter = recvMsgInfoLowerBound(msgNum);
+        bool stored = (iter != m_recvMsgsInfo.end()) && (iter->m_msgNum == msgNum);
+        if (stored && isRecvFieldsPending(*iter)) {
+            break;
+        }
+
+        auto msg = std::move(m_deferredRecvMsgs.front());
+        m_deferredRecvMsgs.pop_front();
+        if (stored && (!recvListSearchActive()) && isRecvListVisible(*iter)) {
+            showAddedMsg(std::move(msg));
+        }
+    }
+}
+
+void GuiAppMgr::reportRecvListCount()
+{
+    m_recvListCountTimer.stop();
+    emit sigRecvListCountReport(m_recvListCount);
 }
 
 void GuiAppMgr::clearRecvList(bool reportDeleted)
@@ -887,26 +1260,22 @@ void GuiAppMgr::clearRecvList(bool reportDeleted)
         emitRecvNotSelected();
     }
 
-    emit sigRecvListCountReport(m_recvListCount);
+    reportRecvListCount();
     emit sigRecvClear(reportDeleted);
 }
 
-bool GuiAppMgr::canAddToRecvList(
-    const ToolsMessage& msg,
-    MsgType type) const
+bool GuiAppMgr::isRecvListVisible(const RecvMsgInfo& info) const
 {
-    assert((type == MsgType::Received) || (type == MsgType::Sent));
-
-    if (msg.idAsString().isEmpty()) {
-        assert(type == MsgType::Received);
+    if ((info.m_flags & RecvMsgFlag_Garbage) != 0U) {
         return recvListShowsGarbage();
     }
 
-    if ((type == MsgType::Sent) && (!recvListShowsSent())) {
+    bool sent = (info.m_flags & RecvMsgFlag_Sent) != 0U;
+    if (sent && (!recvListShowsSent())) {
         return false;
     }
 
-    if ((type == MsgType::Received) && (!recvListShowsReceived())) {
+    if ((!sent) && (!recvListShowsReceived())) {
         return false;
     }
 
@@ -914,9 +1283,179 @@ bool GuiAppMgr::canAddToRecvList(
         return true;
     }
 
-    auto desc = messageDesc(msg);
-    auto iter = std::lower_bound(m_filteredMessages.begin(), m_filteredMessages.end(), desc);
-    return (iter == m_filteredMessages.end()) || (*iter != desc);
+    static const std::uint8_t HiddenMask =
+        RecvMsgFlag_IdFiltered | RecvMsgFlag_FieldsMismatch | RecvMsgFlag_FieldsPending;
+    return (info.m_flags & HiddenMask) == 0U;
+}
+
+bool GuiAppMgr::isRecvFieldsPending(const RecvMsgInfo& info) const
+{
+    return recvListApplyFilter() && ((info.m_flags & RecvMsgFlag_FieldsPending) != 0U);
+}
+
+void GuiAppMgr::storeRecvMsgInfo(const ToolsMessagePtr& msgPtr, MsgType type)
+{
+    assert(msgPtr);
+    auto& msg = *msgPtr;
+    RecvMsgInfo info;
+    info.m_msgNum = ToolsMsgMgr::getMsgNumber(msg);
+    assert(m_recvMsgsInfo.empty() || (m_recvMsgsInfo.back().m_msgNum < info.m_msgNum));
+
+    if (msg.idAsString().isEmpty()) {
+        assert(type == MsgType::Received);
+        info.m_flags |= RecvMsgFlag_Garbage;
+        m_recvMsgsInfo.push_back(info);
+        return;
+    }
+
+    info.m_id = msg.numericId();
+    info.m_idx = property::message::ToolsMsgIdx().getFrom(msg);
+
+    if (type == MsgType::Sent) {
+        info.m_flags |= RecvMsgFlag_Sent;
+    }
+
+    if (isFilteredId(info.m_id, info.m_idx)) {
+        info.m_flags |= RecvMsgFlag_IdFiltered;
+    }
+
+    if (!m_fieldsFilter.isEmpty()) {
+        info.m_flags |= RecvMsgFlag_FieldsPending;
+        m_fieldsFilterWorker.addMsg(info.m_msgNum, msgPtr);
+    }
+
+    m_recvMsgsInfo.push_back(info);
+}
+
+void GuiAppMgr::updateRecvIdFlags()
+{
+    for (auto& info : m_recvMsgsInfo) {
+        if ((info.m_flags & RecvMsgFlag_Garbage) != 0U) {
+            continue;
+        }
+
+        info.m_flags &= static_cast<std::uint8_t>(~RecvMsgFlag_IdFiltered);
+        if (isFilteredId(info.m_id, info.m_idx)) {
+            info.m_flags |= RecvMsgFlag_IdFiltered;
+        }
+    }
+}
+
+void GuiAppMgr::updateRecvFieldsFlags()
+{
+    // Cancels the evaluation in progress
+    m_fieldsFilterWorker.setFilter(m_fieldsFilter);
+    m_fieldsFilterFeedTimer.stop();
+    m_fieldsFilterRefreshPending = false;
+
+    if (m_fieldsFilter.isEmpty()) {
+        for (auto& info : m_recvMsgsInfo) {
+            info.m_flags &= static_cast<std::uint8_t>(~(RecvMsgFlag_FieldsMismatch | RecvMsgFlag_FieldsPending));
+        }
+
+        if (recvListApplyFilter()) {
+            refreshRecvList();
+            return;
+        }
+
+        flushDeferredRecvMsgs();
+        return;
+    }
+
+    if (m_recvMsgsInfo.empty()) {
+        return;
+    }
+
+    // The messages added from now on are queued by storeRecvMsgInfo()
+    m_fieldsFilterFeedNext = m_recvMsgsInfo.front().m_msgNum;
+    m_fieldsFilterFeedEnd = m_recvMsgsInfo.back().m_msgNum + 1U;
+    m_fieldsFilterFed = false;
+    m_fieldsFilterRefreshPending = true;
+    m_fieldsFilterFeedTimer.start();
+}
+
+GuiAppMgr::RecvMsgsInfo::iterator GuiAppMgr::recvMsgInfoLowerBound(ToolsMsgMgr::MsgNumberType msgNum)
+{
+    return
+        std::lower_bound(
+            m_recvMsgsInfo.begin(), m_recvMsgsInfo.end(), msgNum,
+            [](const RecvMsgInfo& info, ToolsMsgMgr::MsgNumberType num)
+            {
+                return info.m_msgNum < num;
+            });
+}
+
+void GuiAppMgr::eraseRecvMsgsInfo(const ToolsMsgMgr::MsgNumbersList& msgNums)
+{
+    // Both are sorted by the message number
+    assert(std::is_sorted(msgNums.begin(), msgNums.end()));
+    auto infoIter = m_recvMsgsInfo.begin();
+    auto writeIter = infoIter;
+    for (auto msgNum : msgNums) {
+        while ((infoIter != m_recvMsgsInfo.end()) && (infoIter->m_msgNum < msgNum)) {
+            *writeIter = *infoIter;
+            ++writeIter;
+            ++infoIter;
+        }
+
+        if ((infoIter != m_recvMsgsInfo.end()) && (infoIter->m_msgNum == msgNum)) {
+            ++infoIter;
+        }
+    }
+
+    writeIter = std::copy(infoIter, m_recvMsgsInfo.end(), writeIter);
+    m_recvMsgsInfo.erase(writeIter, m_recvMsgsInfo.end());
+}
+
+void GuiAppMgr::clearRecvMsgsInfo()
+{
+    m_recvMsgsInfo.clear();
+    m_deferredRecvMsgs.clear();
+}
+
+void GuiAppMgr::updateFilteredIds()
+{
+    m_filteredIdsMasks.clear();
+    m_filteredIdsSet.clear();
+
+    auto protocol = MsgMgrG::instanceRef().getProtocol();
+    if (m_filteredMessages.empty() || (!protocol)) {
+        return;
+    }
+
+    assert(std::is_sorted(m_filteredMessages.begin(), m_filteredMessages.end()));
+    for (auto& entry : protocol->msgCatalog()) {
+        if (!std::binary_search(m_filteredMessages.begin(), m_filteredMessages.end(), messageDesc(entry))) {
+            continue;
+        }
+
+        auto id = entry.m_id;
+        auto idx = entry.m_idx;
+        if ((id < 0) || (DenseFilteredIdsLimit <= id) || (DenseFilteredIdxsLimit <= idx)) {
+            m_filteredIdsSet.insert(qMakePair(id, idx));
+            continue;
+        }
+
+        auto maskIdx = static_cast<std::size_t>(id);
+        if (m_filteredIdsMasks.size() <= maskIdx) {
+            m_filteredIdsMasks.resize(maskIdx + 1U);
+        }
+
+        m_filteredIdsMasks[maskIdx] |= static_cast<std::uint8_t>(1U << idx);
+    }
+}
+
+bool GuiAppMgr::isFilteredId(qlonglong id, unsigned idx) const
+{
+    if ((0 <= id) && (static_cast<unsigned long long>(id) < m_filteredIdsMasks.size()) && (idx < DenseFilteredIdxsLimit)) {
+        return (m_filteredIdsMasks[static_cast<std::size_t>(id)] & (1U << idx)) != 0U;
+    }
+
+    if (m_filteredIdsSet.isEmpty()) {
+        return false;
+    }
+
+    return m_filteredIdsSet.contains(qMakePair(id, idx));
 }
 
 void GuiAppMgr::decRecvListCount()
@@ -925,7 +1464,7 @@ void GuiAppMgr::decRecvListCount()
     if (recvListEmpty()) {
         emitRecvNotSelected();
     }
-    emit sigRecvListCountReport(m_recvListCount);
+    reportRecvListCount();
 }
 
 void GuiAppMgr::decSendListCount()
@@ -18,19 +18,26 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include <QtCore/QObject>
+#include <QtCore/QPair>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QTimer>
 #include <QtWidgets/QWidget>
 
 #include "cc_tools_qt/ToolsMessage.h"
 #include "cc_tools_qt/ToolsPluginMgr.h"
+#include "cc_tools_qt/ToolsMsgPredicate.h"
 #include "cc_tools_qt/ToolsMsgSendMgr.h"
 #include "cc_tools_qt/ToolsProtocol.h"
 
 #include "ActionWrap.h"
+#include "FieldsFilterWorker.h"
 #include "MsgMgrG.h"
 
 namespace cc_tools_qt
@@ -66,6 +73,8 @@ public:
     using ActionPtr = std::shared_ptr<QAction>;
     using ListOfPluginInfos = ToolsPluginMgr::ListOfPluginInfos;
     using FilteredMessages = std::vector<QString>;
+    using LoadConfig = ToolsMsgSendMgr::LoadConfig;
+    using ReplayConfig = ToolsMsgSendMgr::ReplayConfig;
 
     enum class ActivityState
     {
@@ -93,6 +102,7 @@ public:
     bool recvListShowsGarbage() const;
     bool recvListApplyFilter() const;
     unsigned recvListModeMask() const;
+    bool recvListSearchActive() const;
 
     SendState sendState() const;
     void sendAddNewMessage(ToolsMessagePtr msg);
@@ -102,8 +112,12 @@ public:
     void sendSaveMsgsToFile(const QString& filename);
     void sendUpdateList(const ToolsMessagesList& msgs);
 
-    void deleteMessages(ToolsMessagesList&& msgs);
+    void deleteMessages(ToolsMsgMgr::MsgNumbersList&& msgNums);
     void sendMessages(ToolsMessagesList&& msgs);
+    void sendStartLoad(const LoadConfig& config);
+    const LoadConfig& sendLoadConfig() const;
+    void sendStartReplay(const ReplayConfig& config);
+    const ReplayConfig& sendReplayConfig() const;
 
     static ActivityState getActivityState();
     bool applyNewPlugins(const ListOfPluginInfos& plugins);
@@ -112,10 +126,19 @@ public:
     const FilteredMessages& getFilteredMessages() const;
     void setFilteredMessages(FilteredMessages&& filteredMessages);
 
+    const QString& getFieldsFilter() const;
+    void setFieldsFilter(const QString& expr);
+
     static QString messageDesc(const ToolsMessage& msg);
+    static QString messageDesc(const ToolsProtocol::MsgCatalogEntry& entry);
 
     void setDebugOutputLevel(unsigned level);
 
+    // Max rate (Hz) of adding the new messages to the list widgets,
+    // 0 means immediate addition.
+    unsigned getMsgListUpdateRate() const;
+    void setMsgListUpdateRate(unsigned rate);
+
 public slots:
     void pluginsEditClicked();
 
@@ -132,9 +155,12 @@ public slots:
     void recvShowSentToggled(bool checked);
     void recvShowGarbageToggled(bool checked);
     void recvApplyFilterToggled(bool checked);
+    void recvSearchRequested(const QString& query);
 
     void sendStartClicked();
     void sendStartAllClicked();
+    void sendStartLoadClicked();
+    void sendStartReplayClicked();
     void sendStopClicked();
     void sendLoadClicked();
     void sendSaveClicked();
@@ -178,6 +204,7 @@ signals:
     void sigRecvDeleteSelectedMsg();
     void sigSendDeleteSelectedMsg();
     void sigRecvClear(bool reportDeleted);
+    void sigRecvListReset(const ToolsMsgMgr::MsgNumbersList& msgNums, int selectedIdx);
     void sigSendClear();
     void sigRecvListCountReport(unsigned count);
     void sigSendListCountReport(unsigned count);
@@ -206,6 +233,9 @@ signals:
     void sigMsgCommentDialog(ToolsMessagePtr msg);
     void sigMsgCommentUpdated(ToolsMessagePtr msg);
     void sigRecvFilterDialog(ToolsProtocolPtr protocol);
+    void sigLoadGeneratorDialog();
+    void sigReplayDialog();
+    void sigSendStatsReport(const QString& msg);
 
 private:
     enum class SelectionType
@@ -215,6 +245,32 @@ private:
         Send
     };
 
+    enum class SendAllMode
+    {
+        Regular,
+        Load,
+        Replay
+    };
+
+    enum RecvMsgFlag : std::uint8_t
+    {
+        RecvMsgFlag_Sent = 0x1,
+        RecvMsgFlag_Garbage = 0x2,
+        RecvMsgFlag_IdFiltered = 0x4,
+        RecvMsgFlag_FieldsMismatch = 0x8,
+        RecvMsgFlag_FieldsPending = 0x10,
+    };
+
+    struct RecvMsgInfo
+    {
+        ToolsMsgMgr::MsgNumberType m_msgNum = 0U;
+        qlonglong m_id = 0;
+        unsigned m_idx = 0U;
+        std::uint8_t m_flags = 0U;
+    };
+
+    using RecvMsgsInfo = std::vector<RecvMsgInfo>;
+
     GuiAppMgr(QObject* parentObj = nullptr);
     void emitRecvStateUpdate();
     void emitSendStateUpdate();
@@ -223,6 +279,9 @@ private slots:
     void msgAdded(ToolsMessagePtr msg);
     void errorReported(const QString& msg);
     void pendingDisplayTimeout();
+    void reportRecvListCount();
+    void feedFieldsFilter();
+    void fieldsFilterResultsReady();
 
 private /*data*/:
 
@@ -231,14 +290,27 @@ private /*data*/:
     void clearDisplayedMessage();
     void refreshRecvList();
     void addMsgToRecvList(ToolsMessagePtr msg);
+    void showAddedMsg(ToolsMessagePtr msg);
+    void flushDeferredRecvMsgs();
     void clearRecvList(bool reportDeleted);
-    bool canAddToRecvList(const ToolsMessage& msg, MsgType type) const;
+    bool isRecvListVisible(const RecvMsgInfo& info) const;
+    bool isRecvFieldsPending(const RecvMsgInfo& info) const;
+    void storeRecvMsgInfo(const ToolsMessagePtr& msg, MsgType type);
+    void updateRecvIdFlags();
+    void updateRecvFieldsFlags();
+    RecvMsgsInfo::iterator recvMsgInfoLowerBound(ToolsMsgMgr::MsgNumberType msgNum);
+    void eraseRecvMsgsInfo(const ToolsMsgMgr::MsgNumbersList& msgNums);
+    void clearRecvMsgsInfo();
+    void updateFilteredIds();
+    bool isFilteredId(qlonglong id, unsigned idx) const;
     void decRecvListCount();
     void decSendListCount();
     void emitRecvNotSelected();
     void emitSendNotSelected();
     void updateRecvListMode(RecvListMode mode, bool checked);
     void refreshRecvState();
+    void loadStatsReported(const ToolsMsgSendMgr::LoadStats& stats);
+    void replayStatsReported(const ToolsMsgSendMgr::ReplayStats& stats);
 
     RecvState m_recvState = RecvState::Running;
     bool m_recvListSelectOnAdd = true;
@@ -251,6 +323,9 @@ private /*data*/:
 
     SendState m_sendState = SendState::Idle;
     unsigned m_sendListCount = 0;
+    SendAllMode m_sendAllMode = SendAllMode::Regular;
+    LoadConfig m_loadConfig;
+    ReplayConfig m_replayConfig;
 
     SelectionType m_selType = SelectionType::None;
     ToolsMessagePtr m_clickedMsg;
@@ -259,11 +334,43 @@ private /*data*/:
     ToolsMessagePtr m_pendingDisplayMsg;
     bool m_pendingDisplayWaitInProgress = false;
 
+    QTimer m_recvListCountTimer;
+
     ToolsMsgSendMgr m_sendMgr;
 
     FilteredMessages m_filteredMessages;
 
+    // Filtered messages resolved to (numeric ID, idx) pairs, IDs in the
+    // dense range are kept as bitmask of the indices.
+    std::vector<std::uint8_t> m_filteredIdsMasks;
+    QSet<QPair<qlonglong, unsigned> > m_filteredIdsSet;
+    ToolsMsgPredicate m_fieldsFilter;
+
+    // Categories of all the messages in the history, in the order of storage,
+    // the list mode and filter changes are resolved out of them without
+    // decoding or re-evaluating the hidden messages.
+    RecvMsgsInfo m_recvMsgsInfo;
+
+    // The fields filter is evaluated in the background, the history is fed
+    // to the worker in chunks and the list is refreshed once the result of
+    // the last fed message arrives. The added messages awaiting their
+    // result, and all the following ones, are kept out of the list.
+    FieldsFilterWorker m_fieldsFilterWorker;
+    QTimer m_fieldsFilterFeedTimer;
+    ToolsMsgMgr::MsgNumberType m_fieldsFilterFeedNext = 0U;
+    ToolsMsgMgr::MsgNumberType m_fieldsFilterFeedEnd = 0U;
+    ToolsMsgMgr::MsgNumberType m_fieldsFilterLastFed = 0U;
+    bool m_fieldsFilterFed = false;
+    bool m_fieldsFilterRefreshPending = false;
+    std::deque<ToolsMessagePtr> m_deferredRecvMsgs;
+
+    // Numbers of the found messages, the visible ones are resolved
+    // out of the categories above.
+    QString m_searchQuery;
+    ToolsMsgMgr::MsgNumbersList m_searchResults;
+
     unsigned m_debugOutputLevel = 0U;
+    unsigned m_msgListUpdateRate = 0U;
 };
 
 }  // namespace cc_tools_qt
@@ -114,6 +114,18 @@ const QIcon& startAll()
     return iconObj;
 }
 
+const QIcon& startLoad()
+{
+    static const QIcon iconObj(":/image/settings.png");
+    return iconObj;
+}
+
+const QIcon& startReplay()
+{
+    static const QIcon iconObj(":/image/msg_send.png");
+    return iconObj;
+}
+
 const QIcon& stop()
 {
     static const QIcon iconObj(":/image/stop.png");
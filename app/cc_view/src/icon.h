@@ -41,6 +41,8 @@ const QIcon& save();
 const QIcon& saveAs();
 const QIcon& start();
 const QIcon& startAll();
+const QIcon& startLoad();
+const QIcon& startReplay();
 const QIcon& stop();
 const QIcon& edit();
 const QIcon& showRecv();
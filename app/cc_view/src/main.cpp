@@ -37,6 +37,9 @@ const QString CleanOptStr("clean");
 const QString ConfigOptStr("config");
 const QString PluginsOptStr("plugins");
 const QString DebugOptStr("debug");
+const QString CompactHistoryOptStr("compact-history");
+const QString NoSearchIndexOptStr("no-search-index");
+const QString ListUpdateRateOptStr("list-update-rate");
 
 void metaTypesRegisterAll()
 {
@@ -82,6 +85,28 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
         "0"
     );
     parser.addOption(debugOpt);    
+
+    QCommandLineOption compactHistoryOpt(
+        CompactHistoryOptStr,
+        QCoreApplication::translate("main", "Keep only raw data of the received and sent messages in the history, "
+                                            "decode them on demand.")
+    );
+    parser.addOption(compactHistoryOpt);
+
+    QCommandLineOption noSearchIndexOpt(
+        NoSearchIndexOptStr,
+        QCoreApplication::translate("main", "Don't index the field values of the messages for the search.")
+    );
+    parser.addOption(noSearchIndexOpt);
+
+    QCommandLineOption listUpdateRateOpt(
+        ListUpdateRateOptStr,
+        QCoreApplication::translate("main", "Max rate (Hz) of adding the new messages to the lists. "
+                                            "When 0 means every message is added immediately"),
+        QCoreApplication::translate("main", "value") + " (=30)",
+        "30"
+    );
+    parser.addOption(listUpdateRateOpt);
 }
 
 }  // namespace
@@ -97,6 +122,13 @@ int main(int argc, char *argv[])
     prepareCommandLineOptions(parser);
     parser.process(app);
 
+    if (parser.isSet(CompactHistoryOptStr)) {
+        cc_tools_qt::MsgMgrG::instanceRef().setCompactHistoryEnabled(true);
+    }
+
+    cc_tools_qt::MsgMgrG::instanceRef().setSearchIndexEnabled(!parser.isSet(NoSearchIndexOptStr));
+    cc_tools_qt::GuiAppMgr::instanceRef().setMsgListUpdateRate(parser.value(ListUpdateRateOptStr).toUInt());
+
     cc_tools_qt::MainWindowWidget window;
     window.setWindowIcon(cc_tools_qt::icon::appIcon());
     window.showMaximized();
@@ -110,6 +142,7 @@ int main(int argc, char *argv[])
 
     auto& pluginMgr = cc_tools_qt::PluginMgrG::instanceRef();
     pluginMgr.setPluginsDir(pluginsDir);
+    pluginMgr.setCacheFile(QDir(cc_tools_qt::getAppDataDir()).absoluteFilePath("plugins_cache.json"));
 
     auto& guiAppMgr = cc_tools_qt::GuiAppMgr::instanceRef();
     guiAppMgr.setDebugOutputLevel(parser.value(DebugOptStr).toUInt());
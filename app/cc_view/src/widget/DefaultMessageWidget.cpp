@@ -31,7 +31,7 @@ DefaultMessageWidget::DefaultMessageWidget(
     ToolsMessage& msg,
     QWidget* parentObj)
   : Base(parentObj),
-    m_msg(msg),
+    m_msg(&msg),
     m_layout(new LayoutType())
 {
     setLayout(m_layout);
@@ -48,13 +48,13 @@ void DefaultMessageWidget::addExtraTransportFieldWidget(FieldWidget* field)
         return;
     }
 
-    if (m_curExtraTransportFieldIdx != 0) {
+    if (!m_extraTransportFields.empty()) {
         m_layout->insertWidget(m_layout->count() - 1, createFieldSeparator().release());
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
 
-    ++m_curExtraTransportFieldIdx;
+    m_extraTransportFields.push_back(field);
 }
 
 void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
@@ -65,13 +65,35 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
         return;
     }
 
-    if ((m_curFieldIdx != 0) || (m_curExtraTransportFieldIdx != 0)) {
+    if ((!m_fields.empty()) || (!m_extraTransportFields.empty())) {
         m_layout->insertWidget(m_layout->count() - 1, createFieldSeparator().release());
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
 
-    ++m_curFieldIdx;
+    m_fields.push_back(field);
+}
+
+bool DefaultMessageWidget::rebind(ToolsMessage& msg)
+{
+    auto transportFields = msg.transportFields();
+    auto fields = msg.payloadFields();
+    if ((transportFields.size() != m_extraTransportFields.size()) ||
+        (fields.size() != m_fields.size())) {
+        return false;
+    }
+
+    m_msg = &msg;
+    for (std::size_t idx = 0U; idx < transportFields.size(); ++idx) {
+        m_extraTransportFields[idx]->rebind(std::move(transportFields[idx]));
+    }
+
+    for (std::size_t idx = 0U; idx < fields.size(); ++idx) {
+        m_fields[idx]->rebind(std::move(fields[idx]));
+    }
+
+    refresh();
+    return true;
 }
 
 void DefaultMessageWidget::refreshImpl()
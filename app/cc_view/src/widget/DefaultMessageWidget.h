@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <QtWidgets/QVBoxLayout>
 #include <QtWidgets/QFrame>
@@ -41,6 +42,10 @@ public:
     void addExtraTransportFieldWidget(FieldWidget* field);
     void addFieldWidget(FieldWidget* field);
 
+    // Bind the existing fields widgets to the fields of another message
+    // of the same type, returns false on mismatch of the fields.
+    bool rebind(ToolsMessage& msg);
+
 protected:
     virtual void refreshImpl() override;
     virtual void setEditEnabledImpl(bool enabled) override;
@@ -54,10 +59,10 @@ private:
     void connectFieldSignals(FieldWidget* field);
 
     using LayoutType = QVBoxLayout;
-    ToolsMessage& m_msg;
+    ToolsMessage* m_msg = nullptr;
     LayoutType* m_layout;
-    uint m_curExtraTransportFieldIdx = 0;
-    uint m_curFieldIdx = 0;
+    std::vector<FieldWidget*> m_extraTransportFields;
+    std::vector<FieldWidget*> m_fields;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,72 @@
+//
+// Copyright 2014 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "LoadGeneratorDialog.h"
+
+#include <cassert>
+#include <type_traits>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const QString RateUnitsNames[] = {
+    "msg/sec",
+    "bytes/sec"
+};
+
+const std::size_t RateUnitsNamesCount = std::extent<decltype(RateUnitsNames)>::value;
+static_assert(RateUnitsNamesCount == static_cast<std::size_t>(ToolsMsgSendMgr::LoadConfig::RateUnits::NumOfValues),
+    "Invalid map");
+
+}  // namespace
+
+LoadGeneratorDialog::LoadGeneratorDialog(
+    LoadConfig& config,
+    QWidget* parentObj)
+  : Base(parentObj),
+    m_config(config)
+{
+    m_ui.setupUi(this);
+    for (auto& name : RateUnitsNames) {
+        m_ui.m_rateUnitsComboBox->addItem(name);
+    }
+
+    m_ui.m_rateSpinBox->setValue(static_cast<int>(m_config.m_rate));
+    m_ui.m_rateUnitsComboBox->setCurrentIndex(static_cast<int>(m_config.m_rateUnits));
+    m_ui.m_burstSpinBox->setValue(static_cast<int>(m_config.m_burstSize));
+    m_ui.m_durationSpinBox->setValue(static_cast<int>(m_config.m_durationMs / 1000U));
+}
+
+void LoadGeneratorDialog::accept()
+{
+    auto unitsIdx = m_ui.m_rateUnitsComboBox->currentIndex();
+    assert((0 <= unitsIdx) && (unitsIdx < static_cast<int>(RateUnitsNamesCount)));
+
+    m_config.m_rate = static_cast<decltype(m_config.m_rate)>(m_ui.m_rateSpinBox->value());
+    m_config.m_rateUnits = static_cast<LoadConfig::RateUnits>(unitsIdx);
+    m_config.m_burstSize = static_cast<decltype(m_config.m_burstSize)>(m_ui.m_burstSpinBox->value());
+    m_config.m_durationMs = static_cast<decltype(m_config.m_durationMs)>(m_ui.m_durationSpinBox->value()) * 1000U;
+    Base::accept();
+}
+
+}  // namespace cc_tools_qt
+
+
@@ -19,9 +19,11 @@
 
 #include <cassert>
 
+#include <QtWidgets/QDockWidget>
 #include <QtWidgets/QSplitter>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QMessageBox>
+#include <QtWidgets/QStatusBar>
 #include <QtGui/QIcon>
 #include <QtGui/QKeySequence>
 
@@ -37,7 +39,11 @@
 #include "icon.h"
 #include "MainToolbar.h"
 #include "MsgCommentDialog.h"
+#include "LoadGeneratorDialog.h"
+#include "ReplayDialog.h"
 #include "ShortcutWrap.h"
+#include "MsgStatsWidget.h"
+#include "MsgLatencyWidget.h"
 
 namespace cc_tools_qt
 {
@@ -60,6 +66,20 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     splitter->setStretchFactor(1, 1);
     setCentralWidget(splitter);
 
+    auto* statsDock = new QDockWidget(tr("Statistics"), this);
+    statsDock->setObjectName("StatsDock");
+    statsDock->setWidget(new MsgStatsWidget());
+    addDockWidget(Qt::BottomDockWidgetArea, statsDock);
+    statsDock->hide();
+    m_ui.menuView->addAction(statsDock->toggleViewAction());
+
+    auto* latencyDock = new QDockWidget(tr("Latency"), this);
+    latencyDock->setObjectName("LatencyDock");
+    latencyDock->setWidget(new MsgLatencyWidget());
+    addDockWidget(Qt::BottomDockWidgetArea, latencyDock);
+    latencyDock->hide();
+    m_ui.menuView->addAction(latencyDock->toggleViewAction());
+
     new QShortcut(QKeySequence(tr("Ctrl+q")), this, SLOT(close()));
 
     auto* guiAppMgr = GuiAppMgr::instance();
@@ -111,6 +131,15 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     connect(
         guiAppMgr, SIGNAL(sigRecvFilterDialog(ToolsProtocolPtr)),
         this, SLOT(recvFilterDialog(ToolsProtocolPtr)));        
+    connect(
+        guiAppMgr, SIGNAL(sigLoadGeneratorDialog()),
+        this, SLOT(loadGeneratorDialog()));
+    connect(
+        guiAppMgr, SIGNAL(sigReplayDialog()),
+        this, SLOT(replayDialog()));
+    connect(
+        guiAppMgr, SIGNAL(sigSendStatsReport(const QString&)),
+        this, SLOT(sendStatsReport(const QString&)));
 }
 
 MainWindowWidget::~MainWindowWidget() noexcept
@@ -265,6 +294,33 @@ void MainWindowWidget::msgCommentDialog(ToolsMessagePtr msg)
     }
 }
 
+void MainWindowWidget::loadGeneratorDialog()
+{
+    auto* guiAppMgr = GuiAppMgr::instance();
+    auto config = guiAppMgr->sendLoadConfig();
+    LoadGeneratorDialog dialog(config, this);
+    int result = dialog.exec();
+    if (result != 0) {
+        guiAppMgr->sendStartLoad(config);
+    }
+}
+
+void MainWindowWidget::replayDialog()
+{
+    auto* guiAppMgr = GuiAppMgr::instance();
+    auto config = guiAppMgr->sendReplayConfig();
+    ReplayDialog dialog(config, this);
+    int result = dialog.exec();
+    if (result != 0) {
+        guiAppMgr->sendStartReplay(config);
+    }
+}
+
+void MainWindowWidget::sendStatsReport(const QString& msg)
+{
+    statusBar()->showMessage(msg);
+}
+
 void MainWindowWidget::aboutInfo()
 {
     static const QString AboutTxt(
@@ -285,9 +341,11 @@ void MainWindowWidget::recvFilterDialog(ToolsProtocolPtr protocol)
 {
     auto* guiAppMgr = GuiAppMgr::instance();
     GuiAppMgr::FilteredMessages hiddenMessages = guiAppMgr->getFilteredMessages();
-    MessagesFilterDialog dialog(hiddenMessages, std::move(protocol), this);
+    QString fieldsFilter = guiAppMgr->getFieldsFilter();
+    MessagesFilterDialog dialog(hiddenMessages, fieldsFilter, std::move(protocol), this);
     dialog.exec();
     guiAppMgr->setFilteredMessages(std::move(hiddenMessages));
+    guiAppMgr->setFieldsFilter(fieldsFilter);
 }
 
 void MainWindowWidget::clearCustomToolbarActions()
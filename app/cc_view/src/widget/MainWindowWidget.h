@@ -60,6 +60,9 @@ private slots:
     void msgCommentDialog(ToolsMessagePtr msg);
     void aboutInfo();
     void recvFilterDialog(ToolsProtocolPtr protocol);
+    void loadGeneratorDialog();
+    void replayDialog();
+    void sendStatsReport(const QString& msg);
 
 private:
     void clearCustomToolbarActions();
@@ -33,6 +33,7 @@
 
 #include "cc_tools_qt/property/message.h"
 #include "DefaultMessageDisplayWidget.h"
+#include "GuiAppMgr.h"
 
 namespace cc_tools_qt
 {
@@ -40,12 +41,6 @@ namespace cc_tools_qt
 namespace
 {
 
-QString getMessageNameForList(ToolsMessagePtr msg)
-{
-    assert(msg);
-    return QString("(%1) %2").arg(msg->idAsString()).arg(msg->name());
-}
-
 enum class Duration
 {
     Milliseconds,
@@ -175,26 +170,28 @@ MessageUpdateDialog::MessageUpdateDialog(
   : Base(parentObj),
     m_msg(msg),
     m_protocol(std::move(protocol)),
-    m_allMsgs(m_protocol->createAllMessages()),
+    m_catalogMsgs(m_protocol->msgCatalog().size()),
     m_msgDisplayWidget(new DefaultMessageDisplayWidget())
 {
     int msgIdx = -1;
     if (m_msg) {
         m_origScrollPos = property::message::ToolsMsgScrollPos().getFrom(*m_msg);
         auto id = m_msg->idAsString();
-        int msgIdxTmp = 0;
-        for (auto& msgTmp : m_allMsgs) {
-            assert(msgTmp);
-            auto idTmp = msgTmp->idAsString();
-            if ((idTmp == id) && msgTmp->assign(*m_msg)) {
+        auto& catalog = m_protocol->msgCatalog();
+        for (auto idx = 0U; idx < catalog.size(); ++idx) {
+            if (catalog[idx].m_idAsString != id) {
+                continue;
+            }
+
+            auto msgTmp = getCatalogMsg(static_cast<int>(idx));
+            if (msgTmp && msgTmp->assign(*m_msg)) {
                 property::message::ToolsMsgExtraInfo().copyFromTo(*m_msg, *msgTmp);
                 m_protocol->updateMessage(*msgTmp);
                 property::message::ToolsMsgScrollPos().setTo(m_origScrollPos, *msgTmp);
 
-                msgIdx = msgIdxTmp;
+                msgIdx = static_cast<int>(idx);
                 break;
             }
-           ++msgIdxTmp;
         }
     }
 
@@ -312,11 +309,7 @@ MessageUpdateDialog::MessageUpdateDialog(
 
 void MessageUpdateDialog::msgUpdated()
 {
-    auto* item = m_ui.m_msgListWidget->currentItem();
-    auto msgVar = item->data(Qt::UserRole);
-    assert(msgVar.isValid());
-    assert(msgVar.canConvert<ToolsMessagePtr>());
-    auto msg = msgVar.value<ToolsMessagePtr>();
+    auto msg = getMsgFromItem(m_ui.m_msgListWidget->currentItem());
 
     assert(m_protocol);
     assert(msg);
@@ -357,23 +350,25 @@ void MessageUpdateDialog::displayMessagePostponed(ToolsMessagePtr msg, bool forc
 
 void MessageUpdateDialog::refreshDisplayedList(const QString& searchText)
 {
-    ToolsMessagePtr selected;
+    int selected = -1;
     if (0 <= m_ui.m_msgListWidget->currentRow()) {
-        selected = getMsgFromItem(m_ui.m_msgListWidget->currentItem());
+        selected = m_ui.m_msgListWidget->currentItem()->data(Qt::UserRole).toInt();
     }
 
     m_ui.m_msgListWidget->clear();
 
-    for (auto& msg : m_allMsgs) {
-        auto msgName = getMessageNameForList(msg);
+    // Only the names are listed, the messages are created when selected
+    auto& catalog = m_protocol->msgCatalog();
+    for (auto idx = 0U; idx < catalog.size(); ++idx) {
+        auto msgName = GuiAppMgr::messageDesc(catalog[idx]);
         if (searchText.isEmpty() || msgName.contains(searchText, Qt::CaseInsensitive)) {
             m_ui.m_msgListWidget->addItem(msgName);
             auto* item = m_ui.m_msgListWidget->item(m_ui.m_msgListWidget->count() - 1);
             item->setData(
                 Qt::UserRole,
-                QVariant::fromValue(msg));
+                QVariant::fromValue(static_cast<int>(idx)));
 
-            if (selected && (msg.get() == selected.get())) {
+            if (static_cast<int>(idx) == selected) {
                 m_ui.m_msgListWidget->setCurrentItem(item);
             }
         }
@@ -537,8 +532,19 @@ ToolsMessagePtr MessageUpdateDialog::getMsgFromItem(QListWidgetItem* item)
 {
     assert(item);
     auto var = item->data(Qt::UserRole);
-    assert(var.canConvert<ToolsMessagePtr>());
-    return var.value<ToolsMessagePtr>();
+    assert(var.canConvert<int>());
+    return getCatalogMsg(var.toInt());
+}
+
+ToolsMessagePtr MessageUpdateDialog::getCatalogMsg(int idx)
+{
+    assert((0 <= idx) && (static_cast<std::size_t>(idx) < m_catalogMsgs.size()));
+    auto& msg = m_catalogMsgs[static_cast<std::size_t>(idx)];
+    if (!msg) {
+        msg = m_protocol->createCatalogMessage(static_cast<std::size_t>(idx));
+    }
+
+    return msg;
 }
 
 void MessageUpdateDialog::refreshButtons()
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QtWidgets/QDialog>
 
 #include "ui_MessageUpdateDialog.h"
@@ -54,11 +56,12 @@ private slots:
 
 private:
     ToolsMessagePtr getMsgFromItem(QListWidgetItem* item);
+    ToolsMessagePtr getCatalogMsg(int idx);
     void refreshButtons();
 
     ToolsMessagePtr& m_msg;
     ToolsProtocolPtr m_protocol;
-    ToolsMessagesList m_allMsgs;
+    std::vector<ToolsMessagePtr> m_catalogMsgs; // Created on demand
     MessageDisplayWidget* m_msgDisplayWidget = nullptr;
     Ui::MessageUpdateDialog m_ui;
     int m_prevDelay = DisabledDelayValue + 1;
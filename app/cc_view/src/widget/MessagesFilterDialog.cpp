@@ -20,6 +20,8 @@
 
 #include <QtWidgets/QScrollBar>
 
+#include "cc_tools_qt/ToolsMsgPredicate.h"
+
 namespace cc_tools_qt
 {
 
@@ -32,17 +34,20 @@ namespace
 
 MessagesFilterDialog::MessagesFilterDialog(
     FilteredMessages& filteredMessages,
+    QString& fieldsFilter,
     ToolsProtocolPtr protocol,
     QWidget* parentObj)
   : Base(parentObj),
     m_filteredMessages(filteredMessages),
+    m_fieldsFilter(fieldsFilter),
     m_hiddenMessages(m_filteredMessages)
 {
     m_ui.setupUi(this);
+    m_ui.m_fieldsFilterLineEdit->setText(m_fieldsFilter);
+    m_ui.m_fieldsFilterErrorLabel->hide();
 
-    auto allMessages = protocol->createAllMessages();
-    for (auto& msgPtr : allMessages) {
-        m_visibleMessages.push_back(GuiAppMgr::messageDesc(*msgPtr));
+    for (auto& entry : protocol->msgCatalog()) {
+        m_visibleMessages.push_back(GuiAppMgr::messageDesc(entry));
     }
 
     std::sort(m_visibleMessages.begin(), m_visibleMessages.end());
@@ -115,6 +120,16 @@ void MessagesFilterDialog::refreshDisplayedLists(const QString& searchText)
 
 void MessagesFilterDialog::accept()
 {
+    auto fieldsFilter = m_ui.m_fieldsFilterLineEdit->text().trimmed();
+    ToolsMsgPredicate predicate;
+    if (!predicate.compile(fieldsFilter)) {
+        m_ui.m_fieldsFilterErrorLabel->setText(predicate.errorString());
+        m_ui.m_fieldsFilterErrorLabel->show();
+        m_ui.m_fieldsFilterLineEdit->setFocus();
+        return;
+    }
+
+    m_fieldsFilter = fieldsFilter;
     m_filteredMessages = m_hiddenMessages;
     assert(std::is_sorted(m_filteredMessages.begin(), m_filteredMessages.end()));
     Base::accept();
@@ -37,6 +37,7 @@ public:
 
     MessagesFilterDialog(
         FilteredMessages& filteredMessages,
+        QString& fieldsFilter,
         ToolsProtocolPtr protocol,
         QWidget* parentObj = nullptr);
 
@@ -63,6 +64,7 @@ private:
     void moveSelectedItem(const QListWidgetItem* item, FilteredMessages& from, FilteredMessages& to, bool finalUpdate = true);
 
     FilteredMessages& m_filteredMessages;
+    QString& m_fieldsFilter;
     FilteredMessages m_visibleMessages;
     FilteredMessages m_hiddenMessages;
     QString m_searchText;
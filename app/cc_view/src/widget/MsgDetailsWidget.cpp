@@ -62,6 +62,10 @@ MsgDetailsWidget::MsgDetailsWidget(QWidget* parentObj)
     connect(
         scrollBar, SIGNAL(valueChanged(int)),
         this, SLOT(widgetScrolled(int)));
+
+    connect(
+        GuiAppMgr::instance(), SIGNAL(sigActivityStateChanged(int)),
+        this, SLOT(activityStateChanged(int)));
 }
 
 void MsgDetailsWidget::setEditEnabled(bool enabled)
@@ -75,24 +79,28 @@ void MsgDetailsWidget::setEditEnabled(bool enabled)
 void MsgDetailsWidget::displayMessage(ToolsMessagePtr msg)
 {
     assert(msg);
-    auto msgWidget = m_msgDisplayHandler.getMsgWidget(*msg);
-    assert(msgWidget);
+    auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
+    assert(scrollBar != nullptr);
+    scrollBar->blockSignals(true);
+    releaseDisplayedWidget();
+
+    auto* msgWidget = m_msgDisplayHandler.getCachedMsgWidget(msg);
+    assert(msgWidget != nullptr);
     msgWidget->setEditEnabled(m_editEnabled);
 
+    // The widget is reused for the messages of the same type
     connect(
-        msgWidget.get(), SIGNAL(sigMsgUpdated()),
-        this, SIGNAL(sigMsgUpdated()));
+        msgWidget, SIGNAL(sigMsgUpdated()),
+        this, SIGNAL(sigMsgUpdated()),
+        Qt::UniqueConnection);
 
     connect(
-        msgWidget.get(), SIGNAL(sigMsgUpdated()),
-        this, SLOT(msgUpdated()));        
+        msgWidget, SIGNAL(sigMsgUpdated()),
+        this, SLOT(msgUpdated()),
+        Qt::UniqueConnection);
 
-    m_displayedMsgWidget = msgWidget.get();
-
-    auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
-    assert(scrollBar != nullptr);
-    scrollBar->blockSignals(true);
-    m_ui.m_scrollArea->setWidget(msgWidget.release());
+    m_displayedMsgWidget = msgWidget;
+    m_ui.m_scrollArea->setWidget(msgWidget);
     m_displayedMsgWidget->show();
     scrollBar->blockSignals(false);
 
@@ -120,8 +128,7 @@ void MsgDetailsWidget::updateTitle(ToolsMessagePtr msg)
 
 void MsgDetailsWidget::clear()
 {
-    delete m_displayedMsgWidget;
-    m_displayedMsgWidget = nullptr;
+    releaseDisplayedWidget();
     m_displayedMsg.reset();
     m_ui.m_scrollArea->setWidget(new QWidget());
     m_ui.m_groupBox->setTitle(getTitlePrefix());
@@ -143,6 +150,17 @@ void MsgDetailsWidget::widgetScrolled(int value)
     property::message::ToolsMsgScrollPos().setTo(value, *m_displayedMsg);
 }
 
+void MsgDetailsWidget::activityStateChanged(int state)
+{
+    if (state == static_cast<int>(GuiAppMgr::ActivityState::Active)) {
+        return;
+    }
+
+    // The cached widgets refer to the fields provided by the plugins
+    clear();
+    m_msgDisplayHandler.clearCache();
+}
+
 void MsgDetailsWidget::msgUpdated()
 {
     if (sender() != m_displayedMsg.get()) {
@@ -152,4 +170,18 @@ void MsgDetailsWidget::msgUpdated()
     updateTitle(m_displayedMsg);
 }
 
+void MsgDetailsWidget::releaseDisplayedWidget()
+{
+    // The displayed message widget is owned by the display handler
+    auto* widget = m_ui.m_scrollArea->takeWidget();
+    if (widget != m_displayedMsgWidget) {
+        delete widget;
+    }
+
+    if (m_displayedMsgWidget != nullptr) {
+        m_displayedMsgWidget->hide();
+        m_displayedMsgWidget = nullptr;
+    }
+}
+
 } // namespace cc_tools_qt
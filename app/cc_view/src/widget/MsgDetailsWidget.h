@@ -48,9 +48,12 @@ signals:
 
 private slots:
     void widgetScrolled(int value);
+    void activityStateChanged(int state);
     void msgUpdated();
 
 private:
+    void releaseDisplayedWidget();
+
     Ui::MsgDetailsWidget m_ui;
     DefaultMessageDisplayHandler m_msgDisplayHandler;
     MessageWidget* m_displayedMsgWidget = nullptr;
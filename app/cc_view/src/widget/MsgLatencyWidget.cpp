@@ -0,0 +1,348 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgLatencyWidget.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QMessageBox>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QSpinBox>
+#include <QtWidgets/QTableWidget>
+#include <QtWidgets/QVBoxLayout>
+
+#include "cc_tools_qt/ToolsMsgCorrelator.h"
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include "MsgMgrG.h"
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const int RefreshPeriodMs = 1000;
+const int MaxTimeoutMs = 3600000;
+const unsigned long long NoUpdatesCount = std::numeric_limits<unsigned long long>::max();
+
+enum Column
+{
+    Column_ReqId,
+    Column_RspId,
+    Column_ReqKey,
+    Column_RspKey,
+    Column_Requests,
+    Column_Matched,
+    Column_Timeouts,
+    Column_Unmatched,
+    Column_Pending,
+    Column_Latency50,
+    Column_Latency99,
+    Column_LatencyMax,
+    Column_NumOfValues
+};
+
+}  // namespace
+
+MsgLatencyWidget::MsgLatencyWidget(QWidget* parentObj)
+  : Base(parentObj)
+{
+    m_table = new QTableWidget(0, Column_NumOfValues);
+    m_table->setHorizontalHeaderLabels({
+        tr("Request ID"),
+        tr("Response ID"),
+        tr("Request Key"),
+        tr("Response Key"),
+        tr("Requests"),
+        tr("Matched"),
+        tr("Timeouts"),
+        tr("Unmatched"),
+        tr("Pending"),
+        tr("p50 (ms)"),
+        tr("p99 (ms)"),
+        tr("Max (ms)"),
+    });
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_table->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_table->verticalHeader()->hide();
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_table->horizontalHeader()->setSectionResizeMode(Column_ReqKey, QHeaderView::Stretch);
+    m_table->horizontalHeader()->setSectionResizeMode(Column_RspKey, QHeaderView::Stretch);
+    m_table->setToolTip(
+        tr("Message IDs are numeric (e.g. 5 or 0x5), the key is a field path (e.g. seq or hdr.seq),\n"
+           "empty key pairs the responses in the order of the requests, empty response key\n"
+           "means the same path as in the request."));
+
+    auto& correlator = MsgMgrG::instanceRef().getCorrelator();
+    m_table->blockSignals(true);
+    for (auto& rule : correlator.rules()) {
+        auto row = m_table->rowCount();
+        m_table->insertRow(row);
+        setCellText(row, Column_ReqId, QString::number(rule.m_reqId), true);
+        setCellText(row, Column_RspId, QString::number(rule.m_rspId), true);
+        setCellText(row, Column_ReqKey, rule.m_reqKeyPath, true);
+        setCellText(row, Column_RspKey, rule.m_rspKeyPath, true);
+    }
+    m_table->blockSignals(false);
+
+    connect(
+        m_table, SIGNAL(itemChanged(QTableWidgetItem*)),
+        this, SLOT(itemChanged(QTableWidgetItem*)));
+
+    m_timeoutSpinBox = new QSpinBox();
+    m_timeoutSpinBox->setRange(0, MaxTimeoutMs);
+    m_timeoutSpinBox->setSuffix(tr(" ms"));
+    m_timeoutSpinBox->setSpecialValueText(tr("None"));
+    m_timeoutSpinBox->setValue(static_cast<int>(std::min(correlator.timeout(), static_cast<unsigned long long>(MaxTimeoutMs))));
+    connect(
+        m_timeoutSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(setRulesModified()));
+
+    auto* addButton = new QPushButton(tr("Add"));
+    connect(
+        addButton, SIGNAL(clicked()),
+        this, SLOT(addClicked()));
+
+    auto* removeButton = new QPushButton(tr("Remove"));
+    connect(
+        removeButton, SIGNAL(clicked()),
+        this, SLOT(removeClicked()));
+
+    auto* applyButton = new QPushButton(tr("Apply"));
+    applyButton->setToolTip(tr("Apply the rules to the traffic sent and received from now on"));
+    connect(
+        applyButton, SIGNAL(clicked()),
+        this, SLOT(applyClicked()));
+
+    auto* processButton = new QPushButton(tr("Process Stored"));
+    processButton->setToolTip(tr("Apply the rules to all the stored (e.g. loaded) messages"));
+    connect(
+        processButton, SIGNAL(clicked()),
+        this, SLOT(processClicked()));
+
+    auto* bottomLayout = new QHBoxLayout();
+    bottomLayout->addWidget(addButton);
+    bottomLayout->addWidget(removeButton);
+    bottomLayout->addStretch();
+    bottomLayout->addWidget(new QLabel(tr("Timeout:")));
+    bottomLayout->addWidget(m_timeoutSpinBox);
+    bottomLayout->addWidget(applyButton);
+    bottomLayout->addWidget(processButton);
+
+    auto* mainLayout = new QVBoxLayout();
+    mainLayout->addWidget(m_table);
+    mainLayout->addLayout(bottomLayout);
+    setLayout(mainLayout);
+
+    m_refreshTimer.setInterval(RefreshPeriodMs);
+    connect(
+        &m_refreshTimer, SIGNAL(timeout()),
+        this, SLOT(refresh()));
+}
+
+MsgLatencyWidget::~MsgLatencyWidget() noexcept = default;
+
+void MsgLatencyWidget::showEvent(QShowEvent* event)
+{
+    Base::showEvent(event);
+    m_lastUpdatesCount = NoUpdatesCount;
+    refresh();
+    m_refreshTimer.start();
+}
+
+void MsgLatencyWidget::hideEvent(QHideEvent* event)
+{
+    m_refreshTimer.stop();
+    Base::hideEvent(event);
+}
+
+void MsgLatencyWidget::refresh()
+{
+    if (!m_rulesApplied) {
+        return;
+    }
+
+    auto& correlator = MsgMgrG::instanceRef().getCorrelator();
+
+    // The pending requests time out even when the traffic stops,
+    // the statistics of the processed stored messages are final.
+    if (m_liveStats) {
+        correlator.expire(ToolsMsgStats::now());
+    }
+
+    auto updatesCount = correlator.updatesCount();
+    if (updatesCount == m_lastUpdatesCount) {
+        return;
+    }
+
+    m_lastUpdatesCount = updatesCount;
+
+    // The rows are the applied rules while not modified
+    auto count = std::min(static_cast<std::size_t>(m_table->rowCount()), correlator.rules().size());
+    m_table->blockSignals(true);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        auto row = static_cast<int>(idx);
+        auto& stats = correlator.stats(idx);
+        setCellText(row, Column_Requests, QString::number(stats.m_requests));
+        setCellText(row, Column_Matched, QString::number(stats.m_matched));
+        setCellText(row, Column_Timeouts, QString::number(stats.m_timeouts));
+        setCellText(row, Column_Unmatched, QString::number(stats.m_unmatched));
+        setCellText(row, Column_Pending, QString::number(stats.m_pending));
+        setCellText(row, Column_Latency50, QString::number(correlator.latencyPercentile(idx, 50.0)));
+        setCellText(row, Column_Latency99, QString::number(correlator.latencyPercentile(idx, 99.0)));
+        setCellText(row, Column_LatencyMax, QString::number(stats.m_maxLatency));
+    }
+    m_table->blockSignals(false);
+}
+
+void MsgLatencyWidget::addClicked()
+{
+    auto row = m_table->rowCount();
+    m_table->blockSignals(true);
+    m_table->insertRow(row);
+    for (auto col = 0; col < Column_NumOfValues; ++col) {
+        setCellText(row, col, QString(), col < Column_Requests);
+    }
+    m_table->blockSignals(false);
+
+    setRulesModified();
+    m_table->setCurrentCell(row, Column_ReqId);
+    m_table->editItem(m_table->item(row, Column_ReqId));
+}
+
+void MsgLatencyWidget::removeClicked()
+{
+    auto row = m_table->currentRow();
+    if (row < 0) {
+        return;
+    }
+
+    m_table->removeRow(row);
+    setRulesModified();
+}
+
+void MsgLatencyWidget::applyClicked()
+{
+    ToolsMsgCorrelator::RulesList rules;
+    for (auto row = 0; row < m_table->rowCount(); ++row) {
+        ToolsMsgCorrelator::Rule rule;
+        bool reqOk = false;
+        bool rspOk = false;
+        rule.m_reqId = cellText(row, Column_ReqId).trimmed().toLongLong(&reqOk, 0);
+        rule.m_rspId = cellText(row, Column_RspId).trimmed().toLongLong(&rspOk, 0);
+        if ((!reqOk) || (!rspOk)) {
+            QMessageBox::warning(
+                this,
+                tr("Invalid rule"),
+                tr("Invalid message ID in the rule %1.").arg(row + 1));
+            return;
+        }
+
+        rule.m_reqKeyPath = cellText(row, Column_ReqKey).trimmed();
+        rule.m_rspKeyPath = cellText(row, Column_RspKey).trimmed();
+        rules.push_back(std::move(rule));
+    }
+
+    auto& correlator = MsgMgrG::instanceRef().getCorrelator();
+    correlator.setTimeout(static_cast<ToolsMsgCorrelator::TimestampType>(m_timeoutSpinBox->value()));
+    correlator.setRules(std::move(rules));
+
+    m_rulesApplied = true;
+    m_liveStats = true;
+    m_lastUpdatesCount = NoUpdatesCount;
+    refresh();
+}
+
+void MsgLatencyWidget::processClicked()
+{
+    if (!m_rulesApplied) {
+        applyClicked();
+    }
+
+    if (!m_rulesApplied) {
+        return;
+    }
+
+    MsgMgrG::instanceRef().correlateStoredMsgs();
+    m_liveStats = false;
+    refresh();
+}
+
+void MsgLatencyWidget::itemChanged(QTableWidgetItem* item)
+{
+    if ((item != nullptr) && (item->column() < Column_Requests)) {
+        setRulesModified();
+    }
+}
+
+void MsgLatencyWidget::setRulesModified()
+{
+    if (!m_rulesApplied) {
+        return;
+    }
+
+    // The statistics of the previous rules are misleading
+    m_rulesApplied = false;
+    clearStatsCells();
+}
+
+void MsgLatencyWidget::clearStatsCells()
+{
+    m_table->blockSignals(true);
+    for (auto row = 0; row < m_table->rowCount(); ++row) {
+        for (auto col = static_cast<int>(Column_Requests); col < Column_NumOfValues; ++col) {
+            setCellText(row, col, QString());
+        }
+    }
+    m_table->blockSignals(false);
+}
+
+QString MsgLatencyWidget::cellText(int row, int col) const
+{
+    auto* item = m_table->item(row, col);
+    if (item == nullptr) {
+        return QString();
+    }
+
+    return item->text();
+}
+
+void MsgLatencyWidget::setCellText(int row, int col, const QString& text, bool editable)
+{
+    auto* item = m_table->item(row, col);
+    if (item == nullptr) {
+        item = new QTableWidgetItem(text);
+        if (!editable) {
+            item->setFlags(item->flags() & ~Qt::ItemIsEditable);
+        }
+
+        m_table->setItem(row, col, item);
+        return;
+    }
+
+    if (item->text() != text) {
+        item->setText(text);
+    }
+}
+
+}  // namespace cc_tools_qt
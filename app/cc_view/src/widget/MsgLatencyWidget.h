@@ -0,0 +1,69 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <QtCore/QTimer>
+#include <QtWidgets/QWidget>
+
+class QSpinBox;
+class QTableWidget;
+class QTableWidgetItem;
+
+namespace cc_tools_qt
+{
+
+// Configures the request / response correlation rules of the messages
+// manager and displays their latency statistics, gathered live or by
+// processing the stored messages. The statistics are redrawn periodically
+// only while visible and changed.
+class MsgLatencyWidget : public QWidget
+{
+    Q_OBJECT
+    using Base = QWidget;
+public:
+    explicit MsgLatencyWidget(QWidget* parentObj = nullptr);
+    ~MsgLatencyWidget() noexcept;
+
+protected:
+    virtual void showEvent(QShowEvent* event) override;
+    virtual void hideEvent(QHideEvent* event) override;
+
+private slots:
+    void refresh();
+    void addClicked();
+    void removeClicked();
+    void applyClicked();
+    void processClicked();
+    void itemChanged(QTableWidgetItem* item);
+    void setRulesModified();
+
+private:
+    void clearStatsCells();
+    QString cellText(int row, int col) const;
+    void setCellText(int row, int col, const QString& text, bool editable = false);
+
+    QTableWidget* m_table = nullptr;
+    QSpinBox* m_timeoutSpinBox = nullptr;
+    QTimer m_refreshTimer;
+    unsigned long long m_lastUpdatesCount = 0U;
+    bool m_rulesApplied = true;
+    bool m_liveStats = true;
+};
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,308 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgListModel.h"
+
+#include <cassert>
+
+#include <QtCore/QVariant>
+#include <QtGui/QBrush>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const std::size_t MaxCachedMsgs = 256U;
+
+}  // namespace
+
+MsgListModel::MsgListModel(QObject* parentObj)
+  : Base(parentObj)
+{
+}
+
+void MsgListModel::setTextFunc(TextFunc&& func)
+{
+    m_textFunc = std::move(func);
+}
+
+void MsgListModel::setColourFunc(ColourFunc&& func)
+{
+    m_colourFunc = std::move(func);
+}
+
+void MsgListModel::setTooltipFunc(TooltipFunc&& func)
+{
+    m_tooltipFunc = std::move(func);
+}
+
+void MsgListModel::setResolveFunc(ResolveFunc&& func)
+{
+    assert(m_rows.empty());
+    m_resolveFunc = std::move(func);
+}
+
+int MsgListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return count();
+}
+
+QVariant MsgListModel::data(const QModelIndex& index, int role) const
+{
+    if ((!index.isValid()) || (count() <= index.row())) {
+        return QVariant();
+    }
+
+    if ((role == Qt::ToolTipRole) && m_tooltipFunc) {
+        auto& tooltip = m_tooltipFunc();
+        if (!tooltip.isEmpty()) {
+            return tooltip;
+        }
+    }
+
+    if ((role != Qt::DisplayRole) && (role != Qt::ForegroundRole) && (role != Qt::UserRole)) {
+        return QVariant();
+    }
+
+    auto msg = resolve(m_rows[static_cast<std::size_t>(index.row())]);
+    if (!msg) {
+        return QVariant();
+    }
+
+    if ((role == Qt::DisplayRole) && m_textFunc) {
+        return m_textFunc(*msg);
+    }
+
+    if ((role == Qt::ForegroundRole) && m_colourFunc) {
+        return QBrush(m_colourFunc(*msg));
+    }
+
+    if (role == Qt::UserRole) {
+        return QVariant::fromValue(msg);
+    }
+
+    return QVariant();
+}
+
+int MsgListModel::count() const
+{
+    return static_cast<int>(m_rows.size());
+}
+
+ToolsMessagesList MsgListModel::msgs() const
+{
+    // Resolved bypassing the cache to keep the visible rows there
+    ToolsMessagesList result;
+    for (auto& row : m_rows) {
+        auto msg = row.m_msg;
+        if ((!msg) && m_resolveFunc) {
+            msg = m_resolveFunc(row.m_msgNum);
+        }
+
+        if (msg) {
+            result.push_back(std::move(msg));
+        }
+    }
+
+    return result;
+}
+
+MsgListModel::MsgNumbersList MsgListModel::msgNums() const
+{
+    MsgNumbersList result;
+    result.reserve(m_rows.size());
+    for (auto& row : m_rows) {
+        if (row.m_msgNum != 0U) {
+            result.push_back(row.m_msgNum);
+        }
+    }
+
+    return result;
+}
+
+ToolsMessagePtr MsgListModel::msgAt(int row) const
+{
+    assert((0 <= row) && (row < count()));
+    return resolve(m_rows[static_cast<std::size_t>(row)]);
+}
+
+void MsgListModel::appendMsg(ToolsMessagePtr msg)
+{
+    auto row = count();
+    beginInsertRows(QModelIndex(), row, row);
+    m_rows.push_back(makeRow(std::move(msg)));
+    endInsertRows();
+}
+
+void MsgListModel::appendMsgs(const MsgsList& msgs)
+{
+    if (msgs.empty()) {
+        return;
+    }
+
+    auto firstRow = count();
+    auto lastRow = firstRow + static_cast<int>(msgs.size()) - 1;
+    beginInsertRows(QModelIndex(), firstRow, lastRow);
+    m_rows.reserve(m_rows.size() + msgs.size());
+    for (auto& msg : msgs) {
+        m_rows.push_back(makeRow(msg));
+    }
+    endInsertRows();
+}
+
+void MsgListModel::updateMsg(int row, ToolsMessagePtr msg)
+{
+    assert((0 <= row) && (row < count()));
+    auto& rowInfo = m_rows[static_cast<std::size_t>(row)];
+    dropCached(rowInfo.m_msgNum);
+    rowInfo = makeRow(std::move(msg));
+    msgUpdated(row);
+}
+
+void MsgListModel::msgUpdated(int row)
+{
+    auto idx = index(row);
+    emit dataChanged(idx, idx);
+}
+
+void MsgListModel::removeMsg(int row)
+{
+    assert((0 <= row) && (row < count()));
+    beginRemoveRows(QModelIndex(), row, row);
+    dropCached(m_rows[static_cast<std::size_t>(row)].m_msgNum);
+    m_rows.erase(m_rows.begin() + row);
+    endRemoveRows();
+}
+
+void MsgListModel::moveMsg(int fromRow, int toRow)
+{
+    assert((0 <= fromRow) && (fromRow < count()));
+    assert((0 <= toRow) && (toRow < count()));
+    if (fromRow == toRow) {
+        return;
+    }
+
+    // The destination is the row the moved one is inserted before
+    auto destRow = toRow;
+    if (fromRow < toRow) {
+        ++destRow;
+    }
+
+    beginMoveRows(QModelIndex(), fromRow, fromRow, QModelIndex(), destRow);
+    auto rowInfo = std::move(m_rows[static_cast<std::size_t>(fromRow)]);
+    m_rows.erase(m_rows.begin() + fromRow);
+    m_rows.insert(m_rows.begin() + toRow, std::move(rowInfo));
+    endMoveRows();
+}
+
+void MsgListModel::clear()
+{
+    beginResetModel();
+    m_rows.clear();
+    clearCache();
+    endResetModel();
+}
+
+void MsgListModel::setMsgNums(const MsgNumbersList& msgNums)
+{
+    assert(m_resolveFunc);
+    beginResetModel();
+    m_rows.clear();
+    clearCache();
+    m_rows.resize(msgNums.size());
+    for (std::size_t idx = 0U; idx < msgNums.size(); ++idx) {
+        assert(msgNums[idx] != 0U);
+        m_rows[idx].m_msgNum = msgNums[idx];
+    }
+    endResetModel();
+}
+
+MsgListModel::Row MsgListModel::makeRow(ToolsMessagePtr msg) const
+{
+    assert(msg);
+    Row row;
+    if (m_resolveFunc) {
+        row.m_msgNum = ToolsMsgMgr::getMsgNumber(*msg);
+    }
+
+    if (row.m_msgNum == 0U) {
+        row.m_msg = std::move(msg);
+        return row;
+    }
+
+    // The added message is likely to be displayed right away
+    cacheMsg(row.m_msgNum, std::move(msg));
+    return row;
+}
+
+ToolsMessagePtr MsgListModel::resolve(const Row& row) const
+{
+    if (row.m_msg || (!m_resolveFunc)) {
+        return row.m_msg;
+    }
+
+    auto mapIter = m_cachedMsgsMap.find(row.m_msgNum);
+    if (mapIter != m_cachedMsgsMap.end()) {
+        auto cacheIter = mapIter.value();
+        m_cachedMsgs.splice(m_cachedMsgs.begin(), m_cachedMsgs, cacheIter);
+        return cacheIter->second;
+    }
+
+    auto msg = m_resolveFunc(row.m_msgNum);
+    if (!msg) {
+        return msg;
+    }
+
+    cacheMsg(row.m_msgNum, msg);
+    return msg;
+}
+
+void MsgListModel::cacheMsg(MsgNumberType msgNum, ToolsMessagePtr msg) const
+{
+    dropCached(msgNum);
+    m_cachedMsgs.emplace_front(msgNum, std::move(msg));
+    m_cachedMsgsMap.insert(msgNum, m_cachedMsgs.begin());
+    if (MaxCachedMsgs < m_cachedMsgs.size()) {
+        m_cachedMsgsMap.remove(m_cachedMsgs.back().first);
+        m_cachedMsgs.pop_back();
+    }
+}
+
+void MsgListModel::dropCached(MsgNumberType msgNum) const
+{
+    auto mapIter = m_cachedMsgsMap.find(msgNum);
+    if (mapIter == m_cachedMsgsMap.end()) {
+        return;
+    }
+
+    m_cachedMsgs.erase(mapIter.value());
+    m_cachedMsgsMap.erase(mapIter);
+}
+
+void MsgListModel::clearCache()
+{
+    m_cachedMsgs.clear();
+    m_cachedMsgsMap.clear();
+}
+
+}  // namespace cc_tools_qt
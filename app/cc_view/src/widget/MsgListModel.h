@@ -0,0 +1,106 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/qnamespace.h>
+
+#include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgMgr.h"
+
+namespace cc_tools_qt
+{
+
+// Flat list of messages, the displayed text and colour are
+// computed on request only for the visible rows. When the resolve function
+// is set, the rows of the stored messages keep only the message number,
+// the messages are resolved on request and the recently used ones are cached.
+// The messages without number are always kept by the model.
+class MsgListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    using Base = QAbstractListModel;
+public:
+    using MsgNumberType = ToolsMsgMgr::MsgNumberType;
+    using MsgNumbersList = ToolsMsgMgr::MsgNumbersList;
+    using MsgsList = std::vector<ToolsMessagePtr>;
+    using TextFunc = std::function<QString (const ToolsMessage& msg)>;
+    using ColourFunc = std::function<Qt::GlobalColor (const ToolsMessage& msg)>;
+    using TooltipFunc = std::function<const QString& ()>;
+    using ResolveFunc = std::function<ToolsMessagePtr (MsgNumberType msgNum)>;
+
+    explicit MsgListModel(QObject* parentObj = nullptr);
+
+    void setTextFunc(TextFunc&& func);
+    void setColourFunc(ColourFunc&& func);
+    void setTooltipFunc(TooltipFunc&& func);
+    void setResolveFunc(ResolveFunc&& func);
+
+    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    int count() const;
+    ToolsMessagesList msgs() const;
+    MsgNumbersList msgNums() const;
+    ToolsMessagePtr msgAt(int row) const;
+
+    void appendMsg(ToolsMessagePtr msg);
+    void appendMsgs(const MsgsList& msgs);
+    void updateMsg(int row, ToolsMessagePtr msg);
+    void msgUpdated(int row);
+    void removeMsg(int row);
+    void moveMsg(int fromRow, int toRow);
+    void clear();
+    void setMsgNums(const MsgNumbersList& msgNums);
+
+private:
+    struct Row
+    {
+        MsgNumberType m_msgNum = 0U;
+        ToolsMessagePtr m_msg;
+    };
+
+    using RowsList = std::vector<Row>;
+    using CachedMsgs = std::list<std::pair<MsgNumberType, ToolsMessagePtr> >;
+
+    Row makeRow(ToolsMessagePtr msg) const;
+    ToolsMessagePtr resolve(const Row& row) const;
+    void cacheMsg(MsgNumberType msgNum, ToolsMessagePtr msg) const;
+    void dropCached(MsgNumberType msgNum) const;
+    void clearCache();
+
+    RowsList m_rows;
+    TextFunc m_textFunc;
+    ColourFunc m_colourFunc;
+    TooltipFunc m_tooltipFunc;
+    ResolveFunc m_resolveFunc;
+
+    // Recently resolved messages, the most recent first
+    mutable CachedMsgs m_cachedMsgs;
+    mutable QHash<MsgNumberType, CachedMsgs::iterator> m_cachedMsgsMap;
+};
+
+}  // namespace cc_tools_qt
@@ -17,6 +17,7 @@
 
 #include "MsgListWidget.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <QtCore/QVariant>
@@ -45,111 +46,102 @@ MsgListWidget::MsgListWidget(
 {
     m_ui.setupUi(this);
     m_ui.m_groupBoxLayout->insertWidget(0, toolbar);
+
+    m_model = new MsgListModel(this);
+    m_model->setTextFunc(
+        [this](const ToolsMessage& msg)
+        {
+            return getMsgNameText(msg);
+        });
+    m_model->setColourFunc(
+        [this](const ToolsMessage& msg)
+        {
+            return getMsgColour(msg);
+        });
+    m_model->setTooltipFunc(
+        [this]() -> const QString&
+        {
+            return msgTooltipImpl();
+        });
+
+    m_ui.m_listView->setModel(m_model);
+    m_ui.m_listView->setUniformItemSizes(true);
+    m_ui.m_listView->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_ui.m_listView->setEditTriggers(QAbstractItemView::NoEditTriggers);
     updateTitle();
 
-    m_ui.m_listWidget->setUniformItemSizes(true);
     connect(
-        m_ui.m_listWidget, SIGNAL(itemClicked(QListWidgetItem*)),
-        this, SLOT(itemClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(clicked(const QModelIndex&)),
+        this, SLOT(itemClicked(const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(currentItemChanged(QListWidgetItem*, QListWidgetItem*)),
-        this, SLOT(currentItemChanged(QListWidgetItem*, QListWidgetItem*)));
+        m_ui.m_listView->selectionModel(), SIGNAL(currentChanged(const QModelIndex&, const QModelIndex&)),
+        this, SLOT(currentItemChanged(const QModelIndex&, const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(itemDoubleClicked(QListWidgetItem*)),
-        this, SLOT(itemDoubleClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(doubleClicked(const QModelIndex&)),
+        this, SLOT(itemDoubleClicked(const QModelIndex&)));
 
     auto* guiMgr = GuiAppMgr::instance();
     assert(guiMgr != nullptr);
     connect(
         guiMgr, SIGNAL(sigMsgCommentUpdated(ToolsMessagePtr)),
         this, SLOT(msgCommentUpdated(ToolsMessagePtr)));
+
+    auto updateRate = guiMgr->getMsgListUpdateRate();
+    if (0U < updateRate) {
+        static const unsigned MsInSec = 1000U;
+        m_pendingMsgsCoalesced = true;
+        m_pendingMsgsTimer.setSingleShot(true);
+        m_pendingMsgsTimer.setInterval(static_cast<int>(std::max(1U, MsInSec / updateRate)));
+        connect(
+            &m_pendingMsgsTimer, SIGNAL(timeout()),
+            this, SLOT(flushPendingMsgs()));
+    }
 }
 
 void MsgListWidget::addMessage(ToolsMessagePtr msg)
 {
     assert(msg);
-    m_ui.m_listWidget->addItem(getMsgNameText(msg));
-    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
-    item->setToolTip(msgTooltipImpl());
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::ToolsMsgType().getFrom(*msg);
-    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
-
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
-    if (m_selectOnAdd) {
-        m_ui.m_listWidget->blockSignals(true);
-        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
-        m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
+    m_pendingMsgs.push_back(std::move(msg));
+    if (!m_pendingMsgsCoalesced) {
+        flushPendingMsgs();
+        return;
     }
 
-    if (m_ui.m_listWidget->currentRow() < 0) {
-        m_ui.m_listWidget->scrollToBottom();
+    if (!m_pendingMsgsTimer.isActive()) {
+        m_pendingMsgsTimer.start();
     }
-
-    updateTitle();
 }
 
 void MsgListWidget::updateCurrentMessage(ToolsMessagePtr msg)
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = flushPendingMsgsKeepCurrent();
+    if (row < 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_for_update = false;
         assert(No_item_is_selected_for_update);
         return;
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
-    item->setText(getMsgNameText(msg));
-
-    if ((!msg) || (msg->idAsString().isEmpty())) {
-        item->setForeground(defaultItemColour(false));
-        return;
-    }
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::ToolsMsgType().getFrom(*msg);
-    if (type != MsgType::Invalid) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
+    m_model->updateMsg(row, std::move(msg));
 }
 
 void MsgListWidget::deleteCurrentMessage()
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = flushPendingMsgsKeepCurrent();
+    if (row < 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_for_deletion = false;
         assert(No_item_is_selected_for_deletion);        
         return;
     }
 
-    m_ui.m_listWidget->blockSignals(true);
-    delete item; // will remove from the list
-    m_ui.m_listWidget->blockSignals(false);
-
+    m_currentChangeIgnored = true;
+    m_model->removeMsg(row);
+    m_currentChangeIgnored = false;
 
     updateTitle();
 
-    auto* nextItem = m_ui.m_listWidget->currentItem();
-    if (nextItem != nullptr) {
-        processClick(nextItem);
+    auto nextRow = currentRow();
+    if (0 <= nextRow) {
+        processClick(nextRow);
     }
 }
 
@@ -160,32 +152,57 @@ void MsgListWidget::selectOnAdd(bool enabled)
 
 void MsgListWidget::clearSelection()
 {
-    m_ui.m_listWidget->clearSelection();
-    m_ui.m_listWidget->setCurrentRow(-1);
+    flushPendingMsgs();
+    m_ui.m_listView->clearSelection();
+    setCurrentRow(-1);
 }
 
 void MsgListWidget::clearList(bool reportDeleted)
 {
-    ToolsMessagesList msgsList;
+    ToolsMsgMgr::MsgNumbersList msgNums;
     if (reportDeleted) {
-        auto count = m_ui.m_listWidget->count();
-        for (auto idx = 0; idx < count; ++idx) {
-            auto* item = m_ui.m_listWidget->item(idx);
-            auto msg = getMsgFromItem(item);
-            msgsList.push_back(std::move(msg));
+        msgNums = m_model->msgNums();
+        for (auto& msg : m_pendingMsgs) {
+            auto msgNum = ToolsMsgMgr::getMsgNumber(*msg);
+            if (msgNum != 0U) {
+                msgNums.push_back(msgNum);
+            }
         }
     }
 
     clearList();
 
     if (reportDeleted) {
-        msgListClearedImpl(std::move(msgsList));
+        msgListClearedImpl(std::move(msgNums));
     }
 }
 
 void MsgListWidget::clearList()
 {
-    m_ui.m_listWidget->clear();
+    m_pendingMsgsTimer.stop();
+    m_pendingMsgs.clear();
+    m_model->clear();
+    updateTitle();
+}
+
+void MsgListWidget::resetList(const ToolsMsgMgr::MsgNumbersList& msgNums, int selectedIdx)
+{
+    assert(selectedIdx < static_cast<int>(msgNums.size()));
+    m_pendingMsgsTimer.stop();
+    m_pendingMsgs.clear();
+
+    m_currentChangeIgnored = true;
+    m_model->setMsgNums(msgNums);
+    m_currentChangeIgnored = false;
+
+    if (0 <= selectedIdx) {
+        setCurrentRowSilently(selectedIdx);
+        m_ui.m_listView->scrollTo(m_model->index(selectedIdx));
+    }
+    else {
+        m_ui.m_listView->scrollToBottom();
+    }
+
     updateTitle();
 }
 
@@ -196,7 +213,7 @@ void MsgListWidget::stateChanged(int state)
 
 void MsgListWidget::moveSelectedTop()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = flushPendingMsgsKeepCurrent();
     if (curRow <= 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_up_top_item = false;
         assert(No_item_is_selected_or_moving_up_top_item);         
@@ -208,7 +225,7 @@ void MsgListWidget::moveSelectedTop()
 
 void MsgListWidget::moveSelectedUp()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = flushPendingMsgsKeepCurrent();
     if (curRow <= 0) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_up_top_item = false;
         assert(No_item_is_selected_or_moving_up_top_item);
@@ -220,8 +237,8 @@ void MsgListWidget::moveSelectedUp()
 
 void MsgListWidget::moveSelectedDown()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = flushPendingMsgsKeepCurrent();
+    if ((m_model->count() - 1) <= curRow) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_down_bottom_item = false;
         assert(No_item_is_selected_or_moving_down_bottom_item);        
         return;
@@ -232,14 +249,14 @@ void MsgListWidget::moveSelectedDown()
 
 void MsgListWidget::moveSelectedBottom()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = flushPendingMsgsKeepCurrent();
+    if ((m_model->count() - 1) <= curRow) {
         [[maybe_unused]] static constexpr bool No_item_is_selected_or_moving_down_bottom_item = false;
         assert(No_item_is_selected_or_moving_down_bottom_item); 
         return;
     }
 
-    moveItem(curRow, m_ui.m_listWidget->count() - 1);
+    moveItem(curRow, m_model->count() - 1);
 }
 
 void MsgListWidget::titleNeedsUpdate()
@@ -262,15 +279,15 @@ void MsgListWidget::loadMessages(
 
 void MsgListWidget::saveMessages(const QString& filename)
 {
+    flushPendingMsgs();
     saveMessagesImpl(filename);
 }
 
 void MsgListWidget::selectMsg(int idx)
 {
-    assert(idx < m_ui.m_listWidget->count());
-    m_ui.m_listWidget->blockSignals(true);
-    m_ui.m_listWidget->setCurrentRow(idx);
-    m_ui.m_listWidget->blockSignals(false);
+    flushPendingMsgs();
+    assert(idx < m_model->count());
+    setCurrentRowSilently(idx);
 }
 
 void MsgListWidget::msgClickedImpl([[maybe_unused]] ToolsMessagePtr msg, [[maybe_unused]] int idx)
@@ -281,7 +298,7 @@ void MsgListWidget::msgDoubleClickedImpl([[maybe_unused]] ToolsMessagePtr msg, [
 {
 }
 
-void MsgListWidget::msgListClearedImpl([[maybe_unused]] ToolsMessagesList&& msgs)
+void MsgListWidget::msgListClearedImpl([[maybe_unused]] ToolsMsgMgr::MsgNumbersList&& msgNums)
 {
 }
 
@@ -325,27 +342,27 @@ void MsgListWidget::saveMessagesImpl([[maybe_unused]] const QString& filename)
 
 ToolsMessagePtr MsgListWidget::currentMsg() const
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    assert(item != nullptr);
-    return getMsgFromItem(item);
+    auto row = currentRow();
+    assert(0 <= row);
+    return m_model->msgAt(row);
 }
 
 ToolsMessagesList MsgListWidget::allMsgs() const
 {
-    ToolsMessagesList allMsgsList;
-    for (auto idx = 0; idx < m_ui.m_listWidget->count(); ++idx) {
-        auto* item = m_ui.m_listWidget->item(idx);
-        auto msgPtr = getMsgFromItem(item);
-        assert(msgPtr);
-        allMsgsList.push_back(std::move(msgPtr));
-    }
-    return allMsgsList;
+    auto result = m_model->msgs();
+    result.insert(result.end(), m_pendingMsgs.begin(), m_pendingMsgs.end());
+    return result;
 }
 
-void MsgListWidget::itemClicked(QListWidgetItem* item)
+void MsgListWidget::setMsgResolveFunc(MsgListModel::ResolveFunc&& func)
 {
-    assert(item != nullptr);
-    if (m_selectedItem == item) {
+    m_model->setResolveFunc(std::move(func));
+}
+
+void MsgListWidget::itemClicked(const QModelIndex& index)
+{
+    assert(index.isValid());
+    if (m_selectedIdx == index) {
         assert(0 < m_lastSelectionTimestamp);
         auto timestamp = QDateTime::currentMSecsSinceEpoch();
         static const decltype(timestamp) MinThreshold = 250;
@@ -354,15 +371,19 @@ void MsgListWidget::itemClicked(QListWidgetItem* item)
         }
     }
 
-    processClick(item);
+    processClick(index.row());
 }
 
-void MsgListWidget::currentItemChanged(QListWidgetItem* current, [[maybe_unused]] QListWidgetItem* prev)
+void MsgListWidget::currentItemChanged(const QModelIndex& current, [[maybe_unused]] const QModelIndex& prev)
 {
-    m_selectedItem = current;
-    if (current != nullptr) {
+    if (m_currentChangeIgnored) {
+        return;
+    }
+
+    m_selectedIdx = current;
+    if (current.isValid()) {
         m_lastSelectionTimestamp = QDateTime::currentMSecsSinceEpoch();
-        processClick(current);
+        processClick(current.row());
         return;
     }
 
@@ -370,49 +391,87 @@ void MsgListWidget::currentItemChanged(QListWidgetItem* current, [[maybe_unused]
     return;
 }
 
-void MsgListWidget::itemDoubleClicked(QListWidgetItem* item)
+void MsgListWidget::itemDoubleClicked(const QModelIndex& index)
 {
+    assert(index.isValid());
     msgDoubleClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model->msgAt(index.row()),
+        index.row());
 }
 
 void MsgListWidget::msgCommentUpdated(ToolsMessagePtr msg)
 {
     assert(msg);
-    auto item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         return;
     }
 
-    if (msg == getMsgFromItem(item)) {
-        item->setText(getMsgNameText(msg));
+    if (msg == m_model->msgAt(row)) {
+        m_model->msgUpdated(row);
     }
 }
 
-ToolsMessagePtr MsgListWidget::getMsgFromItem(QListWidgetItem* item) const
+void MsgListWidget::flushPendingMsgs()
 {
-    auto var = item->data(Qt::UserRole);
-    assert(var.canConvert<ToolsMessagePtr>());
-    return var.value<ToolsMessagePtr>();
+    m_pendingMsgsTimer.stop();
+    if (m_pendingMsgs.empty()) {
+        return;
+    }
+
+    m_model->appendMsgs(m_pendingMsgs);
+    m_pendingMsgs.clear();
+
+    if (m_selectOnAdd) {
+        setCurrentRowSilently(m_model->count() - 1);
+    }
+
+    if (currentRow() < 0) {
+        m_ui.m_listView->scrollToBottom();
+    }
+
+    updateTitle();
 }
 
-QString MsgListWidget::getMsgNameText(ToolsMessagePtr msg)
+int MsgListWidget::flushPendingMsgsKeepCurrent()
 {
-    assert(msg);
-    auto itemStr = msgPrefixImpl(*msg);
+    // The pending messages are appended, the rows of the existing ones don't
+    // shift, only the selection on add may move the current row.
+    auto row = currentRow();
+    flushPendingMsgs();
+    if ((0 <= row) && (currentRow() != row)) {
+        setCurrentRowSilently(row);
+    }
+
+    return row;
+}
+
+QString MsgListWidget::getMsgNameText(const ToolsMessage& msg) const
+{
+    auto itemStr = msgPrefixImpl(msg);
     if (!itemStr.isEmpty()) {
         itemStr.append(": ");
     }
-    itemStr.append(msg->name());
+    itemStr.append(msg.name());
 
-    auto comment = property::message::ToolsMsgComment().getFrom(*msg);
+    auto comment = property::message::ToolsMsgComment().getFrom(msg);
     if (!comment.isEmpty()) {
         itemStr.append(" (" + comment + ")");
     }
     return itemStr;
 }
 
+Qt::GlobalColor MsgListWidget::getMsgColour(const ToolsMessage& msg) const
+{
+    bool valid = msg.isValid();
+    auto type = property::message::ToolsMsgType().getFrom(msg);
+    if ((type != MsgType::Invalid) && (!msg.idAsString().isEmpty())) {
+        return getItemColourImpl(type, valid);
+    }
+
+    return defaultItemColour(valid);
+}
+
 Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
 {
     if (valid) {
@@ -421,13 +480,39 @@ Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
     return Qt::red;
 }
 
+int MsgListWidget::currentRow() const
+{
+    auto index = m_ui.m_listView->currentIndex();
+    if (!index.isValid()) {
+        return -1;
+    }
+
+    return index.row();
+}
+
+void MsgListWidget::setCurrentRow(int row)
+{
+    if (row < 0) {
+        m_ui.m_listView->setCurrentIndex(QModelIndex());
+        return;
+    }
+
+    m_ui.m_listView->setCurrentIndex(m_model->index(row));
+}
+
+void MsgListWidget::setCurrentRowSilently(int row)
+{
+    m_currentChangeIgnored = true;
+    setCurrentRow(row);
+    m_currentChangeIgnored = false;
+}
+
 void MsgListWidget::moveItem(int fromRow, int toRow)
 {
-    assert(fromRow < m_ui.m_listWidget->count());
-    auto* item = m_ui.m_listWidget->takeItem(fromRow);
-    assert(toRow <= m_ui.m_listWidget->count());
-    m_ui.m_listWidget->insertItem(toRow, item);
-    m_ui.m_listWidget->setCurrentRow(toRow);
+    assert(fromRow < m_model->count());
+    assert(toRow < m_model->count());
+    m_model->moveMsg(fromRow, toRow);
+    setCurrentRow(toRow);
     msgMovedImpl(toRow);
 }
 
@@ -435,15 +520,15 @@ void MsgListWidget::updateTitle()
 {
     auto title =
         m_title +
-        QString(" [%1]").arg(m_ui.m_listWidget->count(), 1, 10, QChar('0'));
+        QString(" [%1]").arg(m_model->count(), 1, 10, QChar('0'));
     m_ui.m_groupBox->setTitle(title);
 }
 
-void MsgListWidget::processClick(QListWidgetItem* item)
+void MsgListWidget::processClick(int row)
 {
     msgClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model->msgAt(row),
+        row);
 }
 
 
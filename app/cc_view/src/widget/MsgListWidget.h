@@ -18,8 +18,13 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QtWidgets/QWidget>
+#include <QtCore/QModelIndex>
+#include <QtCore/QPersistentModelIndex>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/qnamespace.h>
 
 #include "ui_MsgListWidget.h"
@@ -28,6 +33,7 @@
 #include "cc_tools_qt/ToolsProtocol.h"
 
 #include "GuiAppMgr.h"
+#include "MsgListModel.h"
 
 namespace cc_tools_qt
 {
@@ -54,6 +60,7 @@ protected slots:
     void clearSelection();
     void clearList(bool reportDeleted);
     void clearList();
+    void resetList(const ToolsMsgMgr::MsgNumbersList& msgNums, int selectedIdx);
     void stateChanged(int state);
     void moveSelectedTop();
     void moveSelectedUp();
@@ -67,7 +74,7 @@ protected slots:
 protected:
     virtual void msgClickedImpl(ToolsMessagePtr msg, int idx);
     virtual void msgDoubleClickedImpl(ToolsMessagePtr msg, int idx);
-    virtual void msgListClearedImpl(ToolsMessagesList&& msgsList);
+    virtual void msgListClearedImpl(ToolsMsgMgr::MsgNumbersList&& msgNums);
     virtual QString msgPrefixImpl(const ToolsMessage& msg) const;
     virtual const QString& msgTooltipImpl() const;
     virtual void stateChangedImpl(int state);
@@ -79,26 +86,40 @@ protected:
 
     ToolsMessagePtr currentMsg() const;
     ToolsMessagesList allMsgs() const;
+    void setMsgResolveFunc(MsgListModel::ResolveFunc&& func);
 
 private slots:
-    void itemClicked(QListWidgetItem* item);
-    void currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev);
-    void itemDoubleClicked(QListWidgetItem* item);
+    void itemClicked(const QModelIndex& index);
+    void currentItemChanged(const QModelIndex& current, const QModelIndex& prev);
+    void itemDoubleClicked(const QModelIndex& index);
     void msgCommentUpdated(ToolsMessagePtr msg);
+    void flushPendingMsgs();
 
 private:
-    ToolsMessagePtr getMsgFromItem(QListWidgetItem* item) const;
-    QString getMsgNameText(ToolsMessagePtr msg);
+    QString getMsgNameText(const ToolsMessage& msg) const;
+    Qt::GlobalColor getMsgColour(const ToolsMessage& msg) const;
     Qt::GlobalColor defaultItemColour(bool valid) const;
+    int flushPendingMsgsKeepCurrent();
+    int currentRow() const;
+    void setCurrentRow(int row);
+    void setCurrentRowSilently(int row);
     void moveItem(int fromRow, int toRow);
     void updateTitle();
-    void processClick(QListWidgetItem* item);
+    void processClick(int row);
 
     Ui::MsgListWidget m_ui;
+    MsgListModel* m_model = nullptr;
     bool m_selectOnAdd = false;
+    bool m_currentChangeIgnored = false;
     QString m_title;
     qint64 m_lastSelectionTimestamp = 0;
-    QListWidgetItem* m_selectedItem = nullptr;
+    QPersistentModelIndex m_selectedIdx;
+
+    // The new messages are added to the model in batches, at most
+    // once per update interval.
+    MsgListModel::MsgsList m_pendingMsgs;
+    QTimer m_pendingMsgsTimer;
+    bool m_pendingMsgsCoalesced = false;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,202 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgStatsWidget.h"
+
+#include <limits>
+
+#include <QtCore/QDateTime>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTableWidget>
+#include <QtWidgets/QVBoxLayout>
+
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include "MsgMgrG.h"
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const int RefreshPeriodMs = 1000;
+const unsigned long long NoUpdatesCount = std::numeric_limits<unsigned long long>::max();
+
+// The longest rate window, the rates keep changing for this period after the last update
+const ToolsMsgStats::TimestampType RatesDecayMs = 60000U;
+
+enum Column
+{
+    Column_Direction,
+    Column_Name,
+    Column_Id,
+    Column_Count,
+    Column_Rate1s,
+    Column_Rate10s,
+    Column_Rate60s,
+    Column_Bytes,
+    Column_Invalid,
+    Column_LastSeen,
+    Column_NumOfValues
+};
+
+QString rateText(double rate)
+{
+    return QString::number(rate, 'f', 1);
+}
+
+QString timestampText(ToolsMsgStats::TimestampType timestamp)
+{
+    if (timestamp == 0U) {
+        return QString();
+    }
+
+    return QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(timestamp)).toString("hh:mm:ss.zzz");
+}
+
+}  // namespace
+
+MsgStatsWidget::MsgStatsWidget(QWidget* parentObj)
+  : Base(parentObj)
+{
+    m_table = new QTableWidget(0, Column_NumOfValues);
+    m_table->setHorizontalHeaderLabels({
+        tr("Dir"),
+        tr("Message"),
+        tr("ID"),
+        tr("Count"),
+        tr("Rate 1s"),
+        tr("Rate 10s"),
+        tr("Rate 60s"),
+        tr("Bytes"),
+        tr("Invalid"),
+        tr("Last Seen"),
+    });
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_table->verticalHeader()->hide();
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_table->horizontalHeader()->setSectionResizeMode(Column_Name, QHeaderView::Stretch);
+
+    m_garbageLabel = new QLabel();
+
+    auto* resetButton = new QPushButton(tr("Reset"));
+    connect(
+        resetButton, SIGNAL(clicked()),
+        this, SLOT(resetClicked()));
+
+    auto* bottomLayout = new QHBoxLayout();
+    bottomLayout->addWidget(m_garbageLabel);
+    bottomLayout->addStretch();
+    bottomLayout->addWidget(resetButton);
+
+    auto* mainLayout = new QVBoxLayout();
+    mainLayout->addWidget(m_table);
+    mainLayout->addLayout(bottomLayout);
+    setLayout(mainLayout);
+
+    m_refreshTimer.setInterval(RefreshPeriodMs);
+    connect(
+        &m_refreshTimer, SIGNAL(timeout()),
+        this, SLOT(refresh()));
+}
+
+MsgStatsWidget::~MsgStatsWidget() noexcept = default;
+
+void MsgStatsWidget::showEvent(QShowEvent* event)
+{
+    Base::showEvent(event);
+    m_lastUpdatesCount = NoUpdatesCount;
+    refresh();
+    m_refreshTimer.start();
+}
+
+void MsgStatsWidget::hideEvent(QHideEvent* event)
+{
+    m_refreshTimer.stop();
+    Base::hideEvent(event);
+}
+
+void MsgStatsWidget::refresh()
+{
+    auto& stats = MsgMgrG::instanceRef().getStats();
+    auto now = ToolsMsgStats::now();
+    auto updatesCount = stats.updatesCount();
+    if (updatesCount != m_lastUpdatesCount) {
+        m_lastUpdatesCount = updatesCount;
+        m_lastUpdateTimestamp = now;
+    }
+    else if ((m_lastUpdateTimestamp + RatesDecayMs + static_cast<unsigned>(RefreshPeriodMs)) < now) {
+        // Nothing changed and the rates have decayed to 0
+        return;
+    }
+
+    auto count = static_cast<int>(stats.entriesCount());
+    if (m_table->rowCount() != count) {
+        m_table->setRowCount(count);
+    }
+
+    // The entries are only appended, the rows keep their position
+    for (auto row = 0; row < count; ++row) {
+        auto idx = static_cast<std::size_t>(row);
+        auto& entry = stats.entry(idx);
+        auto dirText = (entry.m_type == ToolsMessage::Type::Sent) ? tr("Sent") : tr("Recv");
+        auto idText = QString::number(entry.m_id);
+        if (entry.m_idx != 0U) {
+            idText.append(QString(" (%1)").arg(entry.m_idx));
+        }
+
+        setCellText(row, Column_Direction, dirText);
+        setCellText(row, Column_Name, entry.m_name);
+        setCellText(row, Column_Id, idText);
+        setCellText(row, Column_Count, QString::number(entry.m_count));
+        setCellText(row, Column_Rate1s, rateText(stats.rate(idx, ToolsMsgStats::RateWindow_1s, now)));
+        setCellText(row, Column_Rate10s, rateText(stats.rate(idx, ToolsMsgStats::RateWindow_10s, now)));
+        setCellText(row, Column_Rate60s, rateText(stats.rate(idx, ToolsMsgStats::RateWindow_60s, now)));
+        setCellText(row, Column_Bytes, QString::number(entry.m_bytes));
+        setCellText(row, Column_Invalid, QString::number(entry.m_invalidCount));
+        setCellText(row, Column_LastSeen, timestampText(entry.m_lastSeen));
+    }
+
+    m_garbageLabel->setText(
+        tr("Garbage: %1 messages, %2 bytes").arg(stats.garbageCount()).arg(stats.garbageBytes()));
+}
+
+void MsgStatsWidget::resetClicked()
+{
+    MsgMgrG::instanceRef().clearStats();
+    refresh();
+}
+
+void MsgStatsWidget::setCellText(int row, int col, const QString& text)
+{
+    auto* item = m_table->item(row, col);
+    if (item == nullptr) {
+        m_table->setItem(row, col, new QTableWidgetItem(text));
+        return;
+    }
+
+    if (item->text() != text) {
+        item->setText(text);
+    }
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,58 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <QtCore/QTimer>
+#include <QtWidgets/QWidget>
+
+class QLabel;
+class QTableWidget;
+
+namespace cc_tools_qt
+{
+
+// Displays the traffic statistics gathered by the messages manager,
+// the table is redrawn periodically only while visible.
+class MsgStatsWidget : public QWidget
+{
+    Q_OBJECT
+    using Base = QWidget;
+public:
+    explicit MsgStatsWidget(QWidget* parentObj = nullptr);
+    ~MsgStatsWidget() noexcept;
+
+protected:
+    virtual void showEvent(QShowEvent* event) override;
+    virtual void hideEvent(QHideEvent* event) override;
+
+private slots:
+    void refresh();
+    void resetClicked();
+
+private:
+    void setCellText(int row, int col, const QString& text);
+
+    QTableWidget* m_table = nullptr;
+    QLabel* m_garbageLabel = nullptr;
+    QTimer m_refreshTimer;
+    unsigned long long m_lastUpdatesCount = 0U;
+    unsigned long long m_lastUpdateTimestamp = 0U;
+};
+
+}  // namespace cc_tools_qt
@@ -21,6 +21,7 @@
 
 #include <QtCore/QObject>
 #include <QtGui/QIcon>
+#include <QtWidgets/QLineEdit>
 
 #include "icon.h"
 #include "ShortcutMgr.h"
@@ -145,6 +146,22 @@ QAction* createShowReceived(QToolBar& bar)
     return action;
 }
 
+QLineEdit* createSearchLineEdit()
+{
+    auto* lineEdit = new QLineEdit();
+    lineEdit->setPlaceholderText("Search...");
+    lineEdit->setToolTip(
+        "Search the messages history, press Enter to start.\n"
+        "Space separated terms, all of which must match:\n"
+        "  word or prefix* - text in string fields, enum values or message names;\n"
+        "  MsgName.field.member > value - numeric comparison (=, <, <=, >, >=);\n"
+        "  MsgName.field=min..max - numeric range.\n"
+        "Use * instead of MsgName to search in any message.");
+    lineEdit->setClearButtonEnabled(true);
+    lineEdit->setMaximumWidth(250);
+    return lineEdit;
+}
+
 QAction* createShowSent(QToolBar& bar)
 {
     auto guiAppMgr = GuiAppMgr::instance();
@@ -175,6 +192,7 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_showGarbageButton(createShowGarbage(*this)),
     m_showRecvButton(createShowReceived(*this)),
     m_showSentButton(createShowSent(*this)),
+    m_searchLineEdit(createSearchLineEdit()),
     m_state(GuiAppMgr::instance()->recvState()),
     m_sendState(GuiAppMgr::instance()->sendState()),
     m_activeState(GuiAppMgr::instance()->getActivityState())
@@ -183,6 +201,15 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     auto empty = new QWidget();
     empty->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
     insertWidget(m_applyFilterButton, empty);
+    insertWidget(m_applyFilterButton, m_searchLineEdit);
+
+    connect(
+        m_searchLineEdit, SIGNAL(returnPressed()),
+        this, SLOT(searchRequested()));
+
+    connect(
+        m_searchLineEdit, SIGNAL(textChanged(const QString&)),
+        this, SLOT(searchTextChanged(const QString&)));
 
     connect(
         m_startStopButton, SIGNAL(triggered()),
@@ -270,6 +297,18 @@ void RecvAreaToolBar::activeStateChanged(int state)
     refresh();
 }
 
+void RecvAreaToolBar::searchRequested()
+{
+    GuiAppMgr::instance()->recvSearchRequested(m_searchLineEdit->text());
+}
+
+void RecvAreaToolBar::searchTextChanged(const QString& text)
+{
+    if (text.isEmpty()) {
+        GuiAppMgr::instance()->recvSearchRequested(text);
+    }
+}
+
 void RecvAreaToolBar::refresh()
 {
     refreshStartStopButton();
@@ -280,6 +319,7 @@ void RecvAreaToolBar::refresh()
     refreshDeleteButton();
     refreshClearButton();
     refreshEditFilterButton();
+    refreshSearchLineEdit();
 }
 
 void RecvAreaToolBar::refreshStartStopButton()
@@ -391,6 +431,16 @@ void RecvAreaToolBar::refreshEditFilterButton()
     button->setEnabled(enabled);
 }
 
+void RecvAreaToolBar::refreshSearchLineEdit()
+{
+    auto* lineEdit = m_searchLineEdit;
+    assert(lineEdit != nullptr);
+    bool enabled =
+        (m_activeState == ActivityState::Active) &&
+        MsgMgrG::instanceRef().isSearchIndexEnabled();
+    lineEdit->setEnabled(enabled);
+}
+
 bool RecvAreaToolBar::msgSelected() const
 {
     bool result = (0 <= m_selectedIdx);
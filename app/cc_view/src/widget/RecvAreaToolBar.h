@@ -26,6 +26,7 @@
 #include "GuiAppMgr.h"
 
 class QAction;
+class QLineEdit;
 
 namespace cc_tools_qt
 {
@@ -48,6 +49,8 @@ private slots:
     void recvStateChanged(int state);
     void sendStateChanged(int state);
     void activeStateChanged(int state);
+    void searchRequested();
+    void searchTextChanged(const QString& text);
 
 private:
     void refresh();
@@ -59,6 +62,7 @@ private:
     void refreshDeleteButton();
     void refreshClearButton();
     void refreshEditFilterButton();
+    void refreshSearchLineEdit();
 
     bool msgSelected() const;
     bool listEmpty() const;
@@ -75,6 +79,7 @@ private:
     QAction* m_showGarbageButton = nullptr;
     QAction* m_showRecvButton = nullptr;
     QAction* m_showSentButton = nullptr;
+    QLineEdit* m_searchLineEdit = nullptr;
     State m_state = State::Idle;
     SendState m_sendState = SendState::Idle;
     ActivityState m_activeState = ActivityState::Inactive;
@@ -26,6 +26,7 @@
 #include "RecvAreaToolBar.h"
 #include "GuiAppMgr.h"
 #include "MsgFileMgrG.h"
+#include "MsgMgrG.h"
 
 namespace cc_tools_qt
 {
@@ -38,6 +39,14 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
 
     selectOnAdd(guiMgr->recvMsgListSelectOnAddEnabled());
 
+    // The listed messages are owned by the messages manager, only their
+    // numbers are kept by the list.
+    setMsgResolveFunc(
+        [](ToolsMsgMgr::MsgNumberType msgNum)
+        {
+            return MsgMgrG::instanceRef().findMsg(msgNum);
+        });
+
     connect(
         guiMgr, SIGNAL(sigAddRecvMsg(ToolsMessagePtr)),
         this, SLOT(addMessage(ToolsMessagePtr)));
@@ -53,6 +62,9 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     connect(
         guiMgr, SIGNAL(sigRecvClear(bool)),
         this, SLOT(clearList(bool)));
+    connect(
+        guiMgr, SIGNAL(sigRecvListReset(const ToolsMsgMgr::MsgNumbersList&, int)),
+        this, SLOT(resetList(const ToolsMsgMgr::MsgNumbersList&, int)));
     connect(
         guiMgr, SIGNAL(sigRecvListTitleNeedsUpdate()),
         this, SLOT(titleNeedsUpdate()));
@@ -67,9 +79,9 @@ void RecvMsgListWidget::msgClickedImpl(ToolsMessagePtr msg, int idx)
     GuiAppMgr::instance()->recvMsgClicked(msg, idx);
 }
 
-void RecvMsgListWidget::msgListClearedImpl(ToolsMessagesList&& msgs)
+void RecvMsgListWidget::msgListClearedImpl(ToolsMsgMgr::MsgNumbersList&& msgNums)
 {
-    GuiAppMgr::instance()->deleteMessages(std::move(msgs));
+    GuiAppMgr::instance()->deleteMessages(std::move(msgNums));
 }
 
 QString RecvMsgListWidget::msgPrefixImpl(const ToolsMessage& msg) const
@@ -117,6 +129,11 @@ QString RecvMsgListWidget::getTitlePrefix()
     auto* guiAppMgr = GuiAppMgr::instance();
     assert(guiAppMgr != nullptr);
 
+    if (guiAppMgr->recvListSearchActive()) {
+        static const QString Str("Search Results");
+        return Str;
+    }
+
     if (guiAppMgr->recvListShowsReceived() && guiAppMgr->recvListShowsSent()) {
         static const QString Str("All Messages");
         return Str;
@@ -0,0 +1,42 @@
+//
+// Copyright 2014 - 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ReplayDialog.h"
+
+namespace cc_tools_qt
+{
+
+ReplayDialog::ReplayDialog(
+    ReplayConfig& config,
+    QWidget* parentObj)
+  : Base(parentObj),
+    m_config(config)
+{
+    m_ui.setupUi(this);
+    m_ui.m_speedSpinBox->setValue(m_config.m_speed);
+}
+
+void ReplayDialog::accept()
+{
+    m_config.m_speed = m_ui.m_speedSpinBox->value();
+    Base::accept();
+}
+
+}  // namespace cc_tools_qt
+
+
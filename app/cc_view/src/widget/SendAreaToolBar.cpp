@@ -47,6 +47,24 @@ QAction* createStartAllButton(QToolBar& bar)
     return action;
 }
 
+QAction* createStartLoadButton(QToolBar& bar)
+{
+    auto* action = bar.addAction(icon::startLoad(), "Send All at Target Rate");
+    QObject::connect(
+        action, SIGNAL(triggered()),
+        GuiAppMgr::instance(), SLOT(sendStartLoadClicked()));
+    return action;
+}
+
+QAction* createStartReplayButton(QToolBar& bar)
+{
+    auto* action = bar.addAction(icon::startReplay(), "Replay All at Chosen Speed");
+    QObject::connect(
+        action, SIGNAL(triggered()),
+        GuiAppMgr::instance(), SLOT(sendStartReplayClicked()));
+    return action;
+}
+
 QAction* createLoadButton(QToolBar& bar)
 {
     auto* action = bar.addAction(icon::upload(), "Load Messages");
@@ -183,6 +201,8 @@ SendAreaToolBar::SendAreaToolBar(QWidget* parentObj)
   : Base(parentObj),
     m_startStopButton(createStartButton(*this)),
     m_startStopAllButton(createStartAllButton(*this)),
+    m_startLoadButton(createStartLoadButton(*this)),
+    m_startReplayButton(createStartReplayButton(*this)),
     m_loadButton(createLoadButton(*this)),
     m_saveButton(createSaveButton(*this)),
     m_addButton(createAddButton(*this)),
@@ -288,6 +308,8 @@ void SendAreaToolBar::refresh()
 {
     refreshStartStopButton();
     refreshStartStopAllButton();
+    refreshStartLoadButton();
+    refreshStartReplayButton();
     refreshLoadButton();
     refreshSaveButton();
     refreshAddButtons();
@@ -347,6 +369,28 @@ void SendAreaToolBar::refreshStartStopAllButton()
     ShortcutMgr::instanceRef().updateShortcut(*button, ShortcutMgr::Key_SendAll);
 }
 
+void SendAreaToolBar::refreshStartLoadButton()
+{
+    auto* button = m_startLoadButton;
+    assert(button != nullptr);
+    bool enabled =
+        (m_activeState == ActivityState::Active) &&
+        (!listEmpty()) &&
+        (m_state == State::Idle);
+    button->setEnabled(enabled);
+}
+
+void SendAreaToolBar::refreshStartReplayButton()
+{
+    auto* button = m_startReplayButton;
+    assert(button != nullptr);
+    bool enabled =
+        (m_activeState == ActivityState::Active) &&
+        (!listEmpty()) &&
+        (m_state == State::Idle);
+    button->setEnabled(enabled);
+}
+
 void SendAreaToolBar::refreshLoadButton()
 {
     auto* button = m_loadButton;
@@ -48,6 +48,8 @@ private:
     void refresh();
     void refreshStartStopButton();
     void refreshStartStopAllButton();
+    void refreshStartLoadButton();
+    void refreshStartReplayButton();
     void refreshLoadButton();
     void refreshSaveButton();
     void refreshAddButtons();
@@ -64,6 +66,8 @@ private:
 
     QAction* m_startStopButton = nullptr;
     QAction* m_startStopAllButton = nullptr;
+    QAction* m_startLoadButton = nullptr;
+    QAction* m_startReplayButton = nullptr;
     QAction* m_loadButton = nullptr;
     QAction* m_saveButton = nullptr;
     QAction* m_addButton = nullptr;
@@ -23,6 +23,14 @@
 namespace cc_tools_qt
 {
 
+namespace
+{
+
+// Max number of the elements widgets displayed at once
+const unsigned PageSize = 50U;
+
+}  // namespace
+
 ArrayListElementWidget::ArrayListElementWidget(
     FieldWidget* fieldWidget,
     QWidget* parentObj)
@@ -92,14 +100,28 @@ ArrayListFieldWidget::ArrayListFieldWidget(
     commonConstruct();
 
     assert(m_fieldPtr->canWrite());
+    resetPaging();
     refreshInternal();
     addMissingFields();
 
     updateUi();
+    updatePageUi();
 
     connect(
         m_ui.m_addFieldPushButton, SIGNAL(clicked()),
         this, SLOT(addNewField()));
+
+    connect(
+        m_ui.m_expandToolButton, SIGNAL(toggled(bool)),
+        this, SLOT(expandToggled(bool)));
+
+    connect(
+        m_ui.m_prevPageToolButton, SIGNAL(clicked()),
+        this, SLOT(prevPage()));
+
+    connect(
+        m_ui.m_nextPageToolButton, SIGNAL(clicked()),
+        this, SLOT(nextPage()));
 }
 
 ArrayListFieldWidget::~ArrayListFieldWidget() noexcept = default;
@@ -112,21 +134,37 @@ ToolsField& ArrayListFieldWidget::fieldImpl()
 
 void ArrayListFieldWidget::refreshImpl()
 {
-    while (!m_elements.empty()) {
-        assert(m_elements.back() != nullptr);
-        delete m_elements.back();
-        m_elements.pop_back();
-    }
-
     if (m_fieldPtr->hasFixedSize()) {
         m_fieldPtr->adjustFixedSize();
     }
 
     m_fieldPtr->refreshMembers();
+    refreshElements();
+}
+
+void ArrayListFieldWidget::refreshElements()
+{
+    removeElements();
+
+    auto fieldSize = m_fieldPtr->size();
+    if ((0U < m_pageStart) && (fieldSize <= m_pageStart)) {
+        m_pageStart = 0U;
+        if (0U < fieldSize) {
+            m_pageStart = ((fieldSize - 1U) / PageSize) * PageSize;
+        }
+    }
 
     refreshInternal();
     addMissingFields();
-    assert(m_elements.size() == m_fieldPtr->size());
+    updatePageUi();
+    assert(m_elements.size() == pageElementsCount());
+}
+
+void ArrayListFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    // The elements widgets are recreated on refresh
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+    resetPaging();
 }
 
 void ArrayListFieldWidget::editEnabledUpdatedImpl()
@@ -142,7 +180,7 @@ void ArrayListFieldWidget::dataFieldUpdated()
     if (!m_fieldPtr->canWrite()) {
         auto senderIter = std::find(m_elements.begin(), m_elements.end(), qobject_cast<ArrayListElementWidget*>(sender()));
         assert(senderIter != m_elements.end());
-        auto idx = static_cast<unsigned>(std::distance(m_elements.begin(), senderIter));
+        auto idx = m_pageStart + static_cast<unsigned>(std::distance(m_elements.begin(), senderIter));
         auto& memFields = m_fieldPtr->getMembers();
         assert(idx < memFields.size());
         auto& memWrapPtr = memFields[idx];
@@ -166,8 +204,16 @@ void ArrayListFieldWidget::dataFieldUpdated()
 void ArrayListFieldWidget::addNewField()
 {
     m_fieldPtr->addField();
-    refreshImpl();
-    assert(m_elements.size() == m_fieldPtr->size());
+
+    // Show the page of the added element
+    auto fieldSize = m_fieldPtr->size();
+    assert(0U < fieldSize);
+    m_pageStart = ((fieldSize - 1U) / PageSize) * PageSize;
+    m_expanded = true;
+
+    // The members are updated by the field itself
+    refreshElements();
+    assert(m_elements.size() == pageElementsCount());
     emitFieldUpdated();
 }
 
@@ -181,21 +227,52 @@ void ArrayListFieldWidget::removeField()
         return;
     }
 
-    auto idx = static_cast<int>(std::distance(m_elements.begin(), iter));
+    auto idx = static_cast<int>(m_pageStart) + static_cast<int>(std::distance(m_elements.begin(), iter));
 
     m_fieldPtr->removeField(idx);
 
-    refreshImpl();
+    refreshElements();
 
-    assert(m_elements.size() == m_fieldPtr->size());
+    assert(m_elements.size() == pageElementsCount());
     assert(m_elements.size() == static_cast<unsigned>(m_ui.m_membersLayout->count()));
 
     emitFieldUpdated();
 }
 
+void ArrayListFieldWidget::expandToggled(bool checked)
+{
+    if (m_expanded == checked) {
+        return;
+    }
+
+    m_expanded = checked;
+    refreshPage();
+}
+
+void ArrayListFieldWidget::prevPage()
+{
+    if (m_pageStart == 0U) {
+        return;
+    }
+
+    m_pageStart -= std::min(m_pageStart, PageSize);
+    refreshPage();
+}
+
+void ArrayListFieldWidget::nextPage()
+{
+    auto nextStart = m_pageStart + PageSize;
+    if (m_fieldPtr->size() <= nextStart) {
+        return;
+    }
+
+    m_pageStart = nextStart;
+    refreshPage();
+}
+
 void ArrayListFieldWidget::addDataField(FieldWidget* dataFieldWidget)
 {
-    dataFieldWidget->setNameSuffix(QString(" %1").arg(m_elements.size()));
+    dataFieldWidget->setNameSuffix(QString(" %1").arg(m_pageStart + m_elements.size()));
     auto* fieldPtrWidget = new ArrayListElementWidget(dataFieldWidget);
     fieldPtrWidget->setEditEnabled(isEditEnabled());
     fieldPtrWidget->setDeletable(!m_fieldPtr->hasFixedSize());
@@ -241,15 +318,76 @@ void ArrayListFieldWidget::addMissingFields()
     }
 
     assert(m_elements.empty());
-    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_fieldPtr);
+    auto count = pageElementsCount();
+    if (count == 0U) {
+        return;
+    }
+
+    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_fieldPtr, m_pageStart, count);
     for (auto& fieldWidgetPtr : fieldWidgets) {
         addDataField(fieldWidgetPtr.release());
     }
 
-    assert(m_elements.size() == m_fieldPtr->size());
+    assert(m_elements.size() == count);
     assert(m_elements.size() == static_cast<unsigned>(m_ui.m_membersLayout->count()));
 }
 
+void ArrayListFieldWidget::removeElements()
+{
+    while (!m_elements.empty()) {
+        assert(m_elements.back() != nullptr);
+        delete m_elements.back();
+        m_elements.pop_back();
+    }
+}
+
+void ArrayListFieldWidget::refreshPage()
+{
+    // Only the displayed elements widgets are replaced, the field itself is not modified
+    removeElements();
+    addMissingFields();
+    updatePageUi();
+}
+
+void ArrayListFieldWidget::updatePageUi()
+{
+    auto fieldSize = m_fieldPtr->size();
+    m_ui.m_expandToolButton->blockSignals(true);
+    m_ui.m_expandToolButton->setChecked(m_expanded);
+    m_ui.m_expandToolButton->blockSignals(false);
+    m_ui.m_expandToolButton->setArrowType(m_expanded ? Qt::DownArrow : Qt::RightArrow);
+    m_ui.m_expandToolButton->setVisible(0U < fieldSize);
+    m_ui.m_membersWidget->setVisible(m_expanded);
+
+    bool pagesVisible = m_expanded && (PageSize < fieldSize);
+    m_ui.m_pageWidget->setVisible(pagesVisible);
+    if (!pagesVisible) {
+        return;
+    }
+
+    m_ui.m_pageLabel->setText(
+        QString("%1 - %2 of %3").arg(m_pageStart).arg(m_pageStart + pageElementsCount() - 1U).arg(fieldSize));
+    m_ui.m_prevPageToolButton->setEnabled(0U < m_pageStart);
+    m_ui.m_nextPageToolButton->setEnabled((m_pageStart + PageSize) < fieldSize);
+}
+
+void ArrayListFieldWidget::resetPaging()
+{
+    // Large lists are displayed collapsed to avoid creating all the elements widgets up front
+    m_pageStart = 0U;
+    m_expanded = (m_fieldPtr->size() <= PageSize);
+}
+
+unsigned ArrayListFieldWidget::pageElementsCount() const
+{
+    auto fieldSize = m_fieldPtr->size();
+    if ((!m_expanded) || (fieldSize <= m_pageStart)) {
+        return 0U;
+    }
+
+    return std::min(PageSize, fieldSize - m_pageStart);
+}
+
 }  // namespace cc_tools_qt
 
 
@@ -67,7 +67,8 @@ class ArrayListFieldWidget : public FieldWidget
 public:
     using Field = field::ToolsArrayListField;
     using FieldPtr = field::ToolsArrayListFieldPtr;
-    typedef std::function<std::vector<FieldWidgetPtr> (Field&)> CreateMissingDataFieldsFunc;
+    // Creates widgets for the [from, from + count) range of the members
+    typedef std::function<std::vector<FieldWidgetPtr> (Field&, unsigned from, unsigned count)> CreateMissingDataFieldsFunc;
 
     explicit ArrayListFieldWidget(
         FieldPtr fieldPtr,
@@ -86,12 +87,16 @@ public:
 protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
+    virtual void rebindImpl(ToolsFieldPtr fieldPtr) override;
     virtual void editEnabledUpdatedImpl() override;
 
 private slots:
     void dataFieldUpdated();
     void addNewField();
     void removeField();
+    void expandToggled(bool checked);
+    void prevPage();
+    void nextPage();
 
 private:
 
@@ -99,10 +104,18 @@ private:
     void refreshInternal();
     void updateUi();
     void addMissingFields();
+    void removeElements();
+    void refreshElements();
+    void refreshPage();
+    void updatePageUi();
+    void resetPaging();
+    unsigned pageElementsCount() const;
 
     Ui::ArrayListFieldWidget m_ui;
     FieldPtr m_fieldPtr;
     std::vector<ArrayListElementWidget*> m_elements;
+    unsigned m_pageStart = 0U;
+    bool m_expanded = true;
     CreateMissingDataFieldsFunc m_createMissingDataFieldsCallback;
 };
 
@@ -17,13 +17,39 @@
 
 #include "ArrayListRawDataFieldWidget.h"
 
-#include <algorithm>
 #include <cassert>
-#include <limits>
 
 namespace cc_tools_qt
 {
 
+namespace
+{
+
+HexDataView::DataSeq parseHexBytes(const QString& str)
+{
+    HexDataView::DataSeq result;
+    QString byteStr;
+    for (auto ch : str) {
+        if (((ch < '0') || ('9' < ch)) &&
+            ((ch.toLower() < 'a') || ('f' < ch.toLower()))) {
+            byteStr.clear();
+            continue;
+        }
+
+        byteStr.append(ch);
+        if (byteStr.size() < 2) {
+            continue;
+        }
+
+        result.push_back(static_cast<HexDataView::DataSeq::value_type>(byteStr.toUInt(nullptr, 16)));
+        byteStr.clear();
+    }
+
+    return result;
+}
+
+}  // namespace
+
 ArrayListRawDataFieldWidget::ArrayListRawDataFieldWidget(
     FieldPtr&& fieldPtr,
     QWidget* parentObj)
@@ -36,17 +62,47 @@ ArrayListRawDataFieldWidget::ArrayListRawDataFieldWidget(
     setSeparatorWidget(m_ui.m_sepLine);
     setSerialisedValueWidget(m_ui.m_serValueWidget);
 
+    // The data is accessed via the current field, which may change on rebind
+    m_hexView = new HexDataView();
+    m_hexView->setSizeFunc(
+        [this]()
+        {
+            return m_fieldPtr->dataSize();
+        });
+    m_hexView->setDataFunc(
+        [this](int from, int count)
+        {
+            return m_fieldPtr->getData(from, count);
+        });
+    m_ui.m_dataLayout->addWidget(m_hexView);
+
     commonConstruct();
 
     refresh();
 
     connect(
-        m_ui.m_valuePlainTextEdit, SIGNAL(textChanged()),
-        this, SLOT(valueChanged()));
+        m_hexView, SIGNAL(sigByteEdited(int, int)),
+        this, SLOT(byteEdited(int, int)));
+
+    connect(
+        m_ui.m_sizeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(sizeChanged(int)));
 
     connect(
-        m_ui.m_showAllPushButton, SIGNAL(clicked()),
-        this, SLOT(showAllPressed()));
+        m_ui.m_goToolButton, SIGNAL(clicked()),
+        this, SLOT(goToOffset()));
+
+    connect(
+        m_ui.m_offsetLineEdit, SIGNAL(returnPressed()),
+        this, SLOT(goToOffset()));
+
+    connect(
+        m_ui.m_findToolButton, SIGNAL(clicked()),
+        this, SLOT(findNext()));
+
+    connect(
+        m_ui.m_findLineEdit, SIGNAL(returnPressed()),
+        this, SLOT(findNext()));
 }
 
 ArrayListRawDataFieldWidget::~ArrayListRawDataFieldWidget() noexcept = default;
@@ -63,94 +119,110 @@ void ArrayListRawDataFieldWidget::refreshImpl()
     assert(m_ui.m_serValuePlainTextEdit != nullptr);
     updateSerValue(*m_ui.m_serValuePlainTextEdit, *m_fieldPtr);
 
-    auto value = m_fieldPtr->getValue();
-    bool valueUpdateNeeded = false;
-    do {
-        auto str = m_ui.m_valuePlainTextEdit->toPlainText().toLower();
-        if (str == value) {
-            break;
-        }
-
-        if (((str.size() + 1) == value.size()) &&
-            (value[value.size() - 1] == QChar('0')) &&
-            (str == value.left(value.size() - 1))) {
-            break;
-        }
-
-        valueUpdateNeeded = true;
-    } while (false);
-
-    if (valueUpdateNeeded) {
-        auto curs = m_ui.m_valuePlainTextEdit->textCursor();
-        auto newPosition = std::min(curs.position(), static_cast<int>(value.size()));
-        assert(m_ui.m_valuePlainTextEdit != nullptr);
-        m_ui.m_valuePlainTextEdit->setPlainText(value);
-        curs.setPosition(newPosition);
-        m_ui.m_valuePlainTextEdit->setTextCursor(curs);
-    }
+    updateSizeSpinBox();
+    m_hexView->refresh();
 
     bool valid = m_fieldPtr->valid();
     setValidityStyleSheet(*m_ui.m_nameLabel, valid);
     setValidityStyleSheet(*m_ui.m_serFrontLabel, valid);
-    setValidityStyleSheet(*m_ui.m_valuePlainTextEdit, valid);
     setValidityStyleSheet(*m_ui.m_serValuePlainTextEdit, valid);
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
+    m_hexView->setValid(valid);
+}
 
-    m_ui.m_showAllWidget->setVisible(m_fieldPtr->isTruncated());
+void ArrayListRawDataFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
 }
 
 void ArrayListRawDataFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
-    m_ui.m_valuePlainTextEdit->setReadOnly(readonly);
-    if (readonly) {
+    m_hexView->setReadOnly(readonly);
+    m_ui.m_sizeSpinBox->setReadOnly(readonly || (m_fieldPtr->minSize() == m_fieldPtr->maxSize()));
+}
+
+void ArrayListRawDataFieldWidget::byteEdited(int pos, int value)
+{
+    assert(isEditEnabled());
+    auto oldData = m_fieldPtr->getData(pos, 1);
+    if (oldData.empty()) {
+        return;
+    }
+
+    m_fieldPtr->setData(pos, HexDataView::DataSeq(1U, static_cast<HexDataView::DataSeq::value_type>(value)));
+    if (!m_fieldPtr->canWrite()) {
+        m_fieldPtr->setData(pos, oldData);
+    }
+
+    refresh();
+    emitFieldUpdated();
+}
+
+void ArrayListRawDataFieldWidget::sizeChanged(int value)
+{
+    auto oldSize = m_fieldPtr->dataSize();
+    if ((value == oldSize) || (!isEditEnabled())) {
         return;
     }
 
-    bool refreshNeeded = m_fieldPtr->isTruncated();
-    m_fieldPtr->setForcedShowAll(true);
-    if (refreshNeeded) {
-        refresh();
+    // Keep the truncated bytes to be able to restore them
+    auto removedData = m_fieldPtr->getData(value, oldSize - value);
+    m_fieldPtr->resizeData(value);
+    if (!m_fieldPtr->canWrite()) {
+        m_fieldPtr->resizeData(oldSize);
+        m_fieldPtr->setData(value, removedData);
     }
+
+    refresh();
+    emitFieldUpdated();
 }
 
-void ArrayListRawDataFieldWidget::valueChanged()
+void ArrayListRawDataFieldWidget::goToOffset()
 {
-    auto str = m_ui.m_valuePlainTextEdit->toPlainText();
+    auto str = m_ui.m_offsetLineEdit->text().trimmed();
+    if (str.startsWith("0x", Qt::CaseInsensitive)) {
+        str.remove(0, 2);
+    }
 
-    auto maxLen = std::numeric_limits<int>::max();
-    if (m_fieldPtr->maxSize() < (maxLen / 2)) {
-        maxLen = m_fieldPtr->maxSize() * 2;
+    bool ok = false;
+    auto offset = str.toInt(&ok, 16);
+    if (!ok) {
+        return;
     }
-    auto minLen = m_fieldPtr->minSize() * 2;
 
-    assert(0 <= maxLen);
-    assert(0 <= minLen);
-    assert(minLen <= maxLen);
+    m_hexView->setCursorPosition(offset);
+    m_hexView->setFocus();
+}
 
-    if (maxLen < str.size()) {
-        str.resize(maxLen);
+void ArrayListRawDataFieldWidget::findNext()
+{
+    auto pattern = parseHexBytes(m_ui.m_findLineEdit->text());
+    if (pattern.empty()) {
+        m_hexView->highlight(0, 0);
+        return;
     }
 
-    while (str.size() < minLen) {
-        str.append('0');
+    auto pos = m_hexView->find(pattern, m_hexView->cursorPosition() + 1);
+    if (pos < 0) {
+        pos = m_hexView->find(pattern, 0);
     }
 
-    auto oldValue = m_fieldPtr->getValue();
-    m_fieldPtr->setValue(str);
-    if (!m_fieldPtr->canWrite()) {
-        m_fieldPtr->setValue(oldValue);
+    if (pos < 0) {
+        m_hexView->highlight(0, 0);
+        return;
     }
 
-    m_fieldPtr->setForcedShowAll(true);
-    refresh();
-    emitFieldUpdated();
+    m_hexView->highlight(pos, static_cast<int>(pattern.size()));
+    m_hexView->setCursorPosition(pos);
 }
 
-void ArrayListRawDataFieldWidget::showAllPressed()
+void ArrayListRawDataFieldWidget::updateSizeSpinBox()
 {
-    m_fieldPtr->setForcedShowAll(true);
-    refresh();
+    m_ui.m_sizeSpinBox->blockSignals(true);
+    m_ui.m_sizeSpinBox->setRange(m_fieldPtr->minSize(), m_fieldPtr->maxSize());
+    m_ui.m_sizeSpinBox->setValue(m_fieldPtr->dataSize());
+    m_ui.m_sizeSpinBox->blockSignals(false);
 }
 
 }  // namespace cc_tools_qt
@@ -20,6 +20,7 @@
 
 #include "cc_tools_qt/field/ToolsRawDataField.h"
 #include "FieldWidget.h"
+#include "HexDataView.h"
 
 #include "ui_ArrayListRawDataFieldWidget.h"
 
@@ -42,16 +43,21 @@ public:
 protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
+    virtual void rebindImpl(ToolsFieldPtr fieldPtr) override;
     virtual void editEnabledUpdatedImpl() override;
 
 private slots:
-    void valueChanged();
-    void showAllPressed();
+    void byteEdited(int pos, int value);
+    void sizeChanged(int value);
+    void goToOffset();
+    void findNext();
 
 private:
+    void updateSizeSpinBox();
 
     Ui::ArrayListRawDataFieldWidget m_ui;
     FieldPtr m_fieldPtr;
+    HexDataView* m_hexView = nullptr;
 };
 
 
@@ -84,6 +84,16 @@ void BitfieldFieldWidget::refreshImpl()
     refreshMembers();
 }
 
+void BitfieldFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+    auto& memFields = m_fieldPtr->getMembers();
+    assert(memFields.size() == m_members.size());
+    for (std::size_t idx = 0U; idx < m_members.size(); ++idx) {
+        m_members[idx]->rebind(memFields[idx]->clone());
+    }
+}
+
 void BitfieldFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
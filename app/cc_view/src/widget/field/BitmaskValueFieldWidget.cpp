@@ -91,6 +91,11 @@ void BitmaskValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void BitmaskValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void BitmaskValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -45,6 +45,7 @@ public:
 protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
+    virtual void rebindImpl(ToolsFieldPtr fieldPtr) override;
     virtual void editEnabledUpdatedImpl() override;
 
 private slots:
@@ -75,6 +75,16 @@ void BundleFieldWidget::refreshImpl()
     }
 }
 
+void BundleFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+    auto& memFields = m_fieldPtr->getMembers();
+    assert(memFields.size() == m_members.size());
+    for (std::size_t idx = 0U; idx < m_members.size(); ++idx) {
+        m_members[idx]->rebind(memFields[idx]->clone());
+    }
+}
+
 void BundleFieldWidget::editEnabledUpdatedImpl()
 {
     bool enabled = isEditEnabled();
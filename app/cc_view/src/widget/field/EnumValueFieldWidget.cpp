@@ -122,6 +122,11 @@ void EnumValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void EnumValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void EnumValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -62,6 +62,12 @@ void FieldWidget::setNameSuffix(const QString& value)
     nameSuffixUpdatedImpl();
 }
 
+void FieldWidget::rebind(ToolsFieldPtr fieldPtr)
+{
+    assert(fieldPtr);
+    rebindImpl(std::move(fieldPtr));
+}
+
 void FieldWidget::refresh()
 {
     refreshImpl();
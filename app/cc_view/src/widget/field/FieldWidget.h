@@ -55,6 +55,10 @@ public:
         return fieldImpl();
     }
 
+    // Bind the widget to the same field of another message of the same type,
+    // refresh() is expected to be invoked afterwards.
+    void rebind(ToolsFieldPtr fieldPtr);
+
 public slots:
     void refresh();
     void setEditEnabled(bool enabled);
@@ -121,8 +125,17 @@ protected:
 
     void commonConstruct();
 
+    template <typename TFieldPtr>
+    static TFieldPtr castFieldPtr(ToolsFieldPtr&& fieldPtr)
+    {
+        using FieldType = typename TFieldPtr::element_type;
+        assert(dynamic_cast<FieldType*>(fieldPtr.get()) != nullptr);
+        return TFieldPtr(static_cast<FieldType*>(fieldPtr.release()));
+    }
+
     virtual ToolsField& fieldImpl() = 0;
     virtual void refreshImpl() = 0;
+    virtual void rebindImpl(ToolsFieldPtr fieldPtr) = 0;
     virtual void editEnabledUpdatedImpl();
     virtual void nameSuffixUpdatedImpl();
 
@@ -122,6 +122,11 @@ void FloatValueFieldWidget::refreshImpl()
 
 }
 
+void FloatValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void FloatValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -0,0 +1,415 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "HexDataView.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <QtGui/QFontDatabase>
+#include <QtGui/QFontMetrics>
+#include <QtGui/QKeyEvent>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QScrollBar>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const int BytesPerRow = 16;
+const int OffsetChars = 8;
+const int HexStartChar = OffsetChars + 2;
+const int HexCellChars = 3;
+const int HexGroupSize = 8;
+const int AsciiStartChar = HexStartChar + (BytesPerRow * HexCellChars) + 2;
+const int RowChars = AsciiStartChar + BytesPerRow;
+const int Margin = 4;
+const int MaxHintRows = 12;
+const int SearchChunkSize = 64 * 1024;
+
+QChar asciiChar(std::uint8_t byte)
+{
+    if ((byte < 0x20) || (0x7e < byte)) {
+        return QChar('.');
+    }
+
+    return QChar(static_cast<char>(byte));
+}
+
+}  // namespace
+
+HexDataView::HexDataView(QWidget* parentObj)
+  : Base(parentObj)
+{
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    setFocusPolicy(Qt::StrongFocus);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+    setMinimumWidth((RowChars * charWidth()) + (2 * Margin) + (2 * frameWidth()) + verticalScrollBar()->sizeHint().width());
+}
+
+HexDataView::~HexDataView() noexcept = default;
+
+void HexDataView::setSizeFunc(SizeFunc&& func)
+{
+    m_sizeFunc = std::move(func);
+}
+
+void HexDataView::setDataFunc(DataFunc&& func)
+{
+    m_dataFunc = std::move(func);
+}
+
+void HexDataView::setReadOnly(bool readOnly)
+{
+    m_readOnly = readOnly;
+}
+
+void HexDataView::setValid(bool valid)
+{
+    if (m_valid == valid) {
+        return;
+    }
+
+    m_valid = valid;
+    viewport()->update();
+}
+
+int HexDataView::cursorPosition() const
+{
+    return m_cursorPos;
+}
+
+void HexDataView::setCursorPosition(int pos)
+{
+    moveCursor(pos);
+}
+
+int HexDataView::find(const DataSeq& pattern, int from) const
+{
+    auto size = dataSize();
+    auto patternSize = static_cast<int>(pattern.size());
+    if ((patternSize == 0) || (!m_dataFunc)) {
+        return -1;
+    }
+
+    // The chunks overlap by the pattern length to find the matches on the chunks boundary
+    for (auto start = std::max(from, 0); (start + patternSize) <= size; start += SearchChunkSize) {
+        auto chunk = m_dataFunc(start, SearchChunkSize + patternSize - 1);
+        auto iter = std::search(chunk.begin(), chunk.end(), pattern.begin(), pattern.end());
+        if (iter != chunk.end()) {
+            return start + static_cast<int>(std::distance(chunk.begin(), iter));
+        }
+    }
+
+    return -1;
+}
+
+void HexDataView::highlight(int pos, int count)
+{
+    m_highlightPos = pos;
+    m_highlightCount = count;
+    viewport()->update();
+}
+
+QSize HexDataView::sizeHint() const
+{
+    auto rows = std::min(std::max(rowsCount(), 1), MaxHintRows);
+    return
+        QSize(
+            minimumWidth(),
+            (rows * rowHeight()) + (2 * Margin) + (2 * frameWidth()));
+}
+
+void HexDataView::refresh()
+{
+    auto size = dataSize();
+    m_cursorPos = std::max(0, std::min(m_cursorPos, size - 1));
+    if ((m_highlightPos + m_highlightCount) > size) {
+        m_highlightCount = 0;
+    }
+
+    updateScrollBar();
+    updateGeometry();
+    viewport()->update();
+}
+
+void HexDataView::paintEvent([[maybe_unused]] QPaintEvent* event)
+{
+    if (!m_dataFunc) {
+        return;
+    }
+
+    auto firstPos = verticalScrollBar()->value() * BytesPerRow;
+    auto data = m_dataFunc(firstPos, (visibleRowsCount() + 1) * BytesPerRow);
+    if (data.empty()) {
+        return;
+    }
+
+    QPainter painter(viewport());
+    painter.setFont(font());
+
+    auto& pal = palette();
+    auto textColour = m_valid ? pal.color(QPalette::Text) : QColor(Qt::red);
+    auto offsetColour = pal.color(QPalette::Disabled, QPalette::Text);
+    auto highlightColour = pal.color(QPalette::Highlight);
+    auto cw = charWidth();
+    auto rh = rowHeight();
+    auto ascent = QFontMetrics(font()).ascent();
+    auto dataCount = static_cast<int>(data.size());
+
+    for (auto rowStart = 0; rowStart < dataCount; rowStart += BytesPerRow) {
+        auto y = Margin + ((rowStart / BytesPerRow) * rh);
+        auto baseline = y + ascent;
+
+        painter.setPen(offsetColour);
+        painter.drawText(Margin, baseline, QString("%1").arg(firstPos + rowStart, OffsetChars, 16, QChar('0')));
+
+        auto rowEnd = std::min(rowStart + BytesPerRow, dataCount);
+        for (auto idx = rowStart; idx < rowEnd; ++idx) {
+            auto pos = firstPos + idx;
+            auto col = idx - rowStart;
+            auto byte = data[static_cast<std::size_t>(idx)];
+            QRect hexRect(hexColumnX(col), y, 2 * cw, rh);
+            QRect asciiRect(asciiColumnX(col), y, cw, rh);
+
+            if ((m_highlightPos <= pos) && (pos < (m_highlightPos + m_highlightCount))) {
+                painter.fillRect(hexRect, highlightColour);
+                painter.fillRect(asciiRect, highlightColour);
+            }
+
+            if ((pos == m_cursorPos) && hasFocus()) {
+                auto nibbleRect = hexRect;
+                nibbleRect.setWidth(cw);
+                if (m_lowNibble) {
+                    nibbleRect.translate(cw, 0);
+                }
+
+                painter.fillRect(nibbleRect, highlightColour.lighter());
+                painter.setPen(textColour);
+                painter.drawRect(asciiRect.adjusted(0, 0, -1, -1));
+            }
+
+            painter.setPen(textColour);
+            painter.drawText(hexRect.x(), baseline, QString("%1").arg(static_cast<uint>(byte), 2, 16, QChar('0')));
+            painter.drawText(asciiRect.x(), baseline, QString(asciiChar(byte)));
+        }
+    }
+}
+
+void HexDataView::resizeEvent(QResizeEvent* event)
+{
+    Base::resizeEvent(event);
+    updateScrollBar();
+}
+
+void HexDataView::mousePressEvent(QMouseEvent* event)
+{
+    auto pos = posAt(event->pos());
+    if (0 <= pos) {
+        m_lowNibble = false;
+        moveCursor(pos);
+    }
+
+    Base::mousePressEvent(event);
+}
+
+void HexDataView::keyPressEvent(QKeyEvent* event)
+{
+    auto size = dataSize();
+    auto ctrl = (event->modifiers() & Qt::ControlModifier) != 0;
+    auto pageSize = visibleRowsCount() * BytesPerRow;
+    auto rowStart = (m_cursorPos / BytesPerRow) * BytesPerRow;
+
+    switch (event->key()) {
+        case Qt::Key_Left: moveCursor(m_cursorPos - 1); return;
+        case Qt::Key_Right: moveCursor(m_cursorPos + 1); return;
+        case Qt::Key_Up: moveCursor(m_cursorPos - BytesPerRow); return;
+        case Qt::Key_Down: moveCursor(m_cursorPos + BytesPerRow); return;
+        case Qt::Key_PageUp: moveCursor(m_cursorPos - pageSize); return;
+        case Qt::Key_PageDown: moveCursor(m_cursorPos + pageSize); return;
+        case Qt::Key_Home: moveCursor(ctrl ? 0 : rowStart); return;
+        case Qt::Key_End: moveCursor(ctrl ? (size - 1) : (rowStart + BytesPerRow - 1)); return;
+        default: break;
+    }
+
+    auto text = event->text();
+    if ((!m_readOnly) && (text.size() == 1)) {
+        bool ok = false;
+        auto nibble = text.toInt(&ok, 16);
+        if (ok) {
+            editNibble(nibble);
+            return;
+        }
+    }
+
+    Base::keyPressEvent(event);
+}
+
+int HexDataView::dataSize() const
+{
+    if (!m_sizeFunc) {
+        return 0;
+    }
+
+    return m_sizeFunc();
+}
+
+int HexDataView::rowsCount() const
+{
+    return (dataSize() + BytesPerRow - 1) / BytesPerRow;
+}
+
+int HexDataView::visibleRowsCount() const
+{
+    return std::max(1, (viewport()->height() - (2 * Margin)) / rowHeight());
+}
+
+int HexDataView::charWidth() const
+{
+    return QFontMetrics(font()).horizontalAdvance(QChar('0'));
+}
+
+int HexDataView::rowHeight() const
+{
+    return QFontMetrics(font()).height();
+}
+
+int HexDataView::hexColumnX(int col) const
+{
+    auto chars = HexStartChar + (col * HexCellChars);
+    if (HexGroupSize <= col) {
+        ++chars;
+    }
+
+    return Margin + (chars * charWidth());
+}
+
+int HexDataView::asciiColumnX(int col) const
+{
+    return Margin + ((AsciiStartChar + col) * charWidth());
+}
+
+int HexDataView::posAt(const QPoint& point) const
+{
+    auto rowIdx = (point.y() - Margin) / rowHeight();
+    if ((point.y() < Margin) || (visibleRowsCount() < rowIdx)) {
+        return -1;
+    }
+
+    auto cw = charWidth();
+    auto col = -1;
+    for (auto idx = 0; idx < BytesPerRow; ++idx) {
+        auto hexX = hexColumnX(idx);
+        auto asciiX = asciiColumnX(idx);
+        if (((hexX <= point.x()) && (point.x() < (hexX + (2 * cw)))) ||
+            ((asciiX <= point.x()) && (point.x() < (asciiX + cw)))) {
+            col = idx;
+            break;
+        }
+    }
+
+    if (col < 0) {
+        return -1;
+    }
+
+    auto pos = ((verticalScrollBar()->value() + rowIdx) * BytesPerRow) + col;
+    if (dataSize() <= pos) {
+        return -1;
+    }
+
+    return pos;
+}
+
+void HexDataView::updateScrollBar()
+{
+    auto visibleRows = visibleRowsCount();
+    auto* scrollBar = verticalScrollBar();
+    scrollBar->setRange(0, std::max(0, rowsCount() - visibleRows));
+    scrollBar->setPageStep(visibleRows);
+    scrollBar->setSingleStep(1);
+}
+
+void HexDataView::ensureCursorVisible()
+{
+    auto* scrollBar = verticalScrollBar();
+    auto row = m_cursorPos / BytesPerRow;
+    auto firstRow = scrollBar->value();
+    auto visibleRows = visibleRowsCount();
+    if (row < firstRow) {
+        scrollBar->setValue(row);
+        return;
+    }
+
+    if ((firstRow + visibleRows) <= row) {
+        scrollBar->setValue(row - visibleRows + 1);
+    }
+}
+
+void HexDataView::moveCursor(int pos)
+{
+    auto size = dataSize();
+    if (size <= 0) {
+        return;
+    }
+
+    auto newPos = std::max(0, std::min(pos, size - 1));
+    if (newPos != m_cursorPos) {
+        m_cursorPos = newPos;
+        m_lowNibble = false;
+    }
+
+    ensureCursorVisible();
+    viewport()->update();
+}
+
+void HexDataView::editNibble(int nibble)
+{
+    assert((0 <= nibble) && (nibble <= 0xf));
+    if ((!m_dataFunc) || (dataSize() <= m_cursorPos)) {
+        return;
+    }
+
+    auto data = m_dataFunc(m_cursorPos, 1);
+    assert(data.size() == 1U);
+    auto byte = static_cast<int>(data.front());
+    if (m_lowNibble) {
+        byte = (byte & 0xf0) | nibble;
+    }
+    else {
+        byte = (nibble << 4) | (byte & 0xf);
+    }
+
+    auto pos = m_cursorPos;
+    emit sigByteEdited(pos, byte);
+
+    if (!m_lowNibble) {
+        m_lowNibble = true;
+        viewport()->update();
+        return;
+    }
+
+    m_lowNibble = false;
+    moveCursor(pos + 1);
+}
+
+}  // namespace cc_tools_qt
+
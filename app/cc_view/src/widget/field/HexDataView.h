@@ -0,0 +1,96 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <QtWidgets/QAbstractScrollArea>
+
+namespace cc_tools_qt
+{
+
+// Hex + ASCII view of the raw bytes. Only the visible rows are retrieved
+// and painted, the data is never converted to text as a whole.
+class HexDataView : public QAbstractScrollArea
+{
+    Q_OBJECT
+    using Base = QAbstractScrollArea;
+public:
+    using DataSeq = std::vector<std::uint8_t>;
+    using SizeFunc = std::function<int ()>;
+    using DataFunc = std::function<DataSeq (int from, int count)>;
+
+    explicit HexDataView(QWidget* parentObj = nullptr);
+    ~HexDataView() noexcept;
+
+    void setSizeFunc(SizeFunc&& func);
+    void setDataFunc(DataFunc&& func);
+
+    void setReadOnly(bool readOnly);
+    void setValid(bool valid);
+
+    int cursorPosition() const;
+    void setCursorPosition(int pos);
+
+    // Returns position of the pattern or -1 if not found
+    int find(const DataSeq& pattern, int from) const;
+    void highlight(int pos, int count);
+
+    virtual QSize sizeHint() const override;
+
+public slots:
+    void refresh();
+
+signals:
+    void sigByteEdited(int pos, int value);
+
+protected:
+    virtual void paintEvent(QPaintEvent* event) override;
+    virtual void resizeEvent(QResizeEvent* event) override;
+    virtual void mousePressEvent(QMouseEvent* event) override;
+    virtual void keyPressEvent(QKeyEvent* event) override;
+
+private:
+    int dataSize() const;
+    int rowsCount() const;
+    int visibleRowsCount() const;
+    int charWidth() const;
+    int rowHeight() const;
+    int hexColumnX(int col) const;
+    int asciiColumnX(int col) const;
+    int posAt(const QPoint& point) const;
+    void updateScrollBar();
+    void ensureCursorVisible();
+    void moveCursor(int pos);
+    void editNibble(int nibble);
+
+    SizeFunc m_sizeFunc;
+    DataFunc m_dataFunc;
+    int m_cursorPos = 0;
+    int m_highlightPos = 0;
+    int m_highlightCount = 0;
+    bool m_lowNibble = false;
+    bool m_readOnly = false;
+    bool m_valid = true;
+};
+
+}  // namespace cc_tools_qt
+
@@ -99,6 +99,12 @@ void IntValueFieldWidget::refreshImpl()
     }
 }
 
+void IntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    assert(m_childWidget);
+    m_childWidget->rebind(std::move(fieldPtr));
+}
+
 void IntValueFieldWidget::editEnabledUpdatedImpl()
 {
     if (m_childWidget) {
@@ -41,6 +41,7 @@ public:
 protected:
     virtual ToolsField& fieldImpl() override;
     virtual void refreshImpl() override;
+    virtual void rebindImpl(ToolsFieldPtr fieldPtr) override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void nameSuffixUpdatedImpl() override;
 
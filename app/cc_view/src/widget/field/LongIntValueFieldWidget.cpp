@@ -90,6 +90,11 @@ void LongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void LongIntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void LongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -86,6 +86,11 @@ void LongLongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void LongLongIntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void LongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
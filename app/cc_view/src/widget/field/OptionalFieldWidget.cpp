@@ -74,6 +74,17 @@ void OptionalFieldWidget::refreshImpl()
     refreshField();
 }
 
+void OptionalFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+    if (m_fieldPtr->getMode() == Mode::Tentative) {
+        m_fieldPtr->setMode(Mode::Missing);
+    }
+
+    assert(m_field != nullptr);
+    m_field->rebind(m_fieldPtr->getField().clone());
+}
+
 void OptionalFieldWidget::editEnabledUpdatedImpl()
 {
     assert(m_field != nullptr);
@@ -94,6 +94,11 @@ void ScaledIntValueFieldWidget::refreshImpl()
     }
 }
 
+void ScaledIntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void ScaledIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -88,6 +88,11 @@ void ShortIntValueFieldWidget::refreshImpl()
     }
 }
 
+void ShortIntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void ShortIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -76,6 +76,11 @@ void StringFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void StringFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void StringFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -63,6 +63,11 @@ void UnknownValueFieldWidget::refreshImpl()
     setFieldValid(m_fieldPtr->valid());
 }
 
+void UnknownValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<field::ToolsUnknownFieldPtr>(std::move(fieldPtr));
+}
+
 void UnknownValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
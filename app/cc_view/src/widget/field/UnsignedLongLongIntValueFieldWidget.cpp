@@ -88,6 +88,11 @@ void UnsignedLongLongIntValueFieldWidget::refreshImpl()
     }
 }
 
+void UnsignedLongLongIntValueFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+}
+
 void UnsignedLongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -92,6 +92,31 @@ void VariantFieldWidget::refreshImpl()
     refreshMember();
 }
 
+void VariantFieldWidget::rebindImpl(ToolsFieldPtr fieldPtr)
+{
+    // The previous field may be already destructed, its member index is
+    // reflected by the index spin box.
+    auto prevIdx = m_ui.m_idxSpinBox->value();
+    m_fieldPtr = castFieldPtr<FieldPtr>(std::move(fieldPtr));
+    updateIndexValue();
+    updateMemberCombo();
+
+    auto* memberField = m_fieldPtr->getCurrent();
+    if ((m_member != nullptr) && (memberField != nullptr) && (prevIdx == m_fieldPtr->getCurrentIndex())) {
+        m_member->rebind(memberField->clone());
+        return;
+    }
+
+    delete m_member;
+    m_member = nullptr;
+    if (memberField == nullptr) {
+        return;
+    }
+
+    createMemberWidget();
+    m_member->setEditEnabled(isEditEnabled());
+}
+
 void VariantFieldWidget::editEnabledUpdatedImpl()
 {
     bool readOnly = !isEditEnabled();
@@ -0,0 +1,176 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks the request / response pairing, timeouts and latency percentiles
+// of cc_tools_qt::ToolsMsgCorrelator over the capture of the demo protocol
+// messages.
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "cc_tools_qt/ToolsMsgCorrelator.h"
+#include "cc_tools_qt/property/message.h"
+
+#include "message/EnumValues.h"
+#include "message/IntValues.h"
+
+namespace
+{
+
+using Correlator = cc_tools_qt::ToolsMsgCorrelator;
+using MsgType = cc_tools_qt::ToolsMessage::Type;
+
+unsigned g_failures = 0U;
+
+void check(bool cond, const char* desc, unsigned long long actual)
+{
+    if (cond) {
+        return;
+    }
+
+    std::cerr << "FAILED: " << desc << " (actual: " << actual << ")" << std::endl;
+    ++g_failures;
+}
+
+#define CHECK_EQUAL(actual_, expected_) \
+    check((actual_) == (expected_), #actual_ " == " #expected_, static_cast<unsigned long long>(actual_))
+
+void setProps(cc_tools_qt::ToolsMessage& msg, MsgType type, unsigned long long timestamp)
+{
+    cc_tools_qt::property::message::ToolsMsgType().setTo(type, msg);
+    cc_tools_qt::property::message::ToolsMsgTimestamp().setTo(timestamp, msg);
+}
+
+// IntValues correlated by the field1 value in both directions
+void addIntValues(cc_tools_qt::ToolsMessagesList& msgs, MsgType type, unsigned long long timestamp, unsigned key)
+{
+    auto msg = std::make_shared<demo::cc_plugin::message::IntValues>();
+    msg->msg().field_field1().value() = static_cast<std::uint16_t>(key);
+    setProps(*msg, type, timestamp);
+    msgs.push_back(std::move(msg));
+}
+
+// EnumValues correlated in the order of sending
+void addEnumValues(cc_tools_qt::ToolsMessagesList& msgs, MsgType type, unsigned long long timestamp)
+{
+    auto msg = std::make_shared<demo::cc_plugin::message::EnumValues>();
+    setProps(*msg, type, timestamp);
+    msgs.push_back(std::move(msg));
+}
+
+}  // namespace
+
+int main()
+{
+    static const unsigned long long TimeoutMs = 100U;
+
+    Correlator correlator;
+    Correlator::RulesList rules;
+
+    Correlator::Rule keyedRule;
+    keyedRule.m_reqId = demo::MsgId_IntValues;
+    keyedRule.m_rspId = demo::MsgId_IntValues;
+    keyedRule.m_reqKeyPath = "field 1";
+    rules.push_back(keyedRule);
+
+    Correlator::Rule orderedRule;
+    orderedRule.m_reqId = demo::MsgId_EnumValues;
+    orderedRule.m_rspId = demo::MsgId_EnumValues;
+    rules.push_back(orderedRule);
+
+    correlator.setTimeout(TimeoutMs);
+    correlator.setRules(std::move(rules));
+
+    cc_tools_qt::ToolsMessagesList msgs;
+
+    // Out of order responses: latencies 10 and 25
+    addIntValues(msgs, MsgType::Sent, 1000U, 1U);
+    addIntValues(msgs, MsgType::Sent, 1005U, 2U);
+    addIntValues(msgs, MsgType::Received, 1015U, 2U);
+    addIntValues(msgs, MsgType::Received, 1025U, 1U);
+
+    // Never responded, times out with the following traffic
+    addIntValues(msgs, MsgType::Sent, 1030U, 3U);
+
+    // No such request
+    addIntValues(msgs, MsgType::Received, 1040U, 7U);
+
+    // Latencies 1 to 100, the last one is exactly at the timeout
+    for (unsigned idx = 0U; idx < 100U; ++idx) {
+        auto timestamp = 2000U + (idx * 200U);
+        addIntValues(msgs, MsgType::Sent, timestamp, 4U);
+        addIntValues(msgs, MsgType::Received, timestamp + idx + 1U, 4U);
+    }
+
+    // In order pairing: latencies 30 and 40, the last one is expired at the end
+    addEnumValues(msgs, MsgType::Sent, 30000U);
+    addEnumValues(msgs, MsgType::Sent, 30010U);
+    addEnumValues(msgs, MsgType::Received, 30030U);
+    addEnumValues(msgs, MsgType::Received, 30050U);
+    addEnumValues(msgs, MsgType::Sent, 30060U);
+
+    // Late traffic, no such request either
+    addIntValues(msgs, MsgType::Received, 30200U, 9U);
+
+    correlator.process(msgs);
+
+    auto& keyedStats = correlator.stats(0U);
+    CHECK_EQUAL(keyedStats.m_requests, 103U);
+    CHECK_EQUAL(keyedStats.m_matched, 102U);
+    CHECK_EQUAL(keyedStats.m_timeouts, 1U);
+    CHECK_EQUAL(keyedStats.m_unmatched, 2U);
+    CHECK_EQUAL(keyedStats.m_pending, 0U);
+    CHECK_EQUAL(keyedStats.m_maxLatency, 100U);
+
+    // The 51st of the 102 sorted latencies {1..100, 10, 25} is 49
+    CHECK_EQUAL(correlator.latencyPercentile(0U, 50.0), 49U);
+    // The 101st is 99, which is the upper bound of its 2 ms wide bucket
+    CHECK_EQUAL(correlator.latencyPercentile(0U, 99.0), 99U);
+    CHECK_EQUAL(correlator.latencyPercentile(0U, 100.0), 100U);
+
+    auto& orderedStats = correlator.stats(1U);
+    CHECK_EQUAL(orderedStats.m_requests, 3U);
+    CHECK_EQUAL(orderedStats.m_matched, 2U);
+    CHECK_EQUAL(orderedStats.m_timeouts, 1U);
+    CHECK_EQUAL(orderedStats.m_unmatched, 0U);
+    CHECK_EQUAL(orderedStats.m_pending, 0U);
+    CHECK_EQUAL(correlator.latencyPercentile(1U, 50.0), 30U);
+    CHECK_EQUAL(correlator.latencyPercentile(1U, 99.0), 40U);
+    CHECK_EQUAL(orderedStats.m_maxLatency, 40U);
+
+    // Processing again produces the same statistics
+    correlator.process(msgs);
+    CHECK_EQUAL(correlator.stats(0U).m_matched, 102U);
+    CHECK_EQUAL(correlator.stats(1U).m_timeouts, 1U);
+
+    // Without the timeout nothing expires
+    correlator.setTimeout(0U);
+    correlator.process(msgs);
+    CHECK_EQUAL(correlator.stats(0U).m_timeouts, 0U);
+    CHECK_EQUAL(correlator.stats(0U).m_pending, 1U);
+    CHECK_EQUAL(correlator.stats(1U).m_pending, 1U);
+
+    if (g_failures != 0U) {
+        std::cerr << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
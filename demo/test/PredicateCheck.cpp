@@ -0,0 +1,175 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks the parsing and the evaluation of the cc_tools_qt::ToolsMsgPredicate
+// expressions on the demo protocol messages.
+
+#include <iostream>
+
+#include "cc_tools_qt/ToolsMsgPredicate.h"
+
+#include "message/FloatValues.h"
+#include "message/IntValues.h"
+#include "message/Strings.h"
+
+namespace
+{
+
+using Predicate = cc_tools_qt::ToolsMsgPredicate;
+
+unsigned g_failures = 0U;
+
+void checkMatch(const char* expr, cc_tools_qt::ToolsMessage& msg, bool expected)
+{
+    Predicate predicate;
+    if (!predicate.compile(expr)) {
+        std::cerr << "FAILED: compile(\"" << expr << "\"): " << predicate.errorString().toStdString() << std::endl;
+        ++g_failures;
+        return;
+    }
+
+    auto result = predicate.matches(msg);
+    if (result == expected) {
+        return;
+    }
+
+    std::cerr << "FAILED: \"" << expr << "\" on " << msg.name() << " (actual: " << result << ")" << std::endl;
+    ++g_failures;
+}
+
+void checkSyntaxError(const char* expr)
+{
+    Predicate predicate;
+    if ((!predicate.compile(expr)) && (!predicate.errorString().isEmpty())) {
+        return;
+    }
+
+    std::cerr << "FAILED: \"" << expr << "\" is expected to fail compilation" << std::endl;
+    ++g_failures;
+}
+
+}  // namespace
+
+int main()
+{
+    demo::cc_plugin::message::IntValues intMsg;
+    intMsg.msg().field_field1().value() = 3U;
+    intMsg.msg().field_field2().value() = -10;
+
+    demo::cc_plugin::message::Strings strMsg;
+    strMsg.msg().field_field1().value() = "hello";
+
+    demo::cc_plugin::message::FloatValues floatMsg;
+    floatMsg.msg().field_field1().value() = 2.5f;
+
+    // Empty expression matches everything
+    checkMatch("", intMsg, true);
+    checkMatch("   ", strMsg, true);
+
+    // && binds tighter than ||, ! binds to the following operand
+    checkMatch("1 == 0 && 1 == 0 || 1 == 1", intMsg, true);
+    checkMatch("1 == 1 || 1 == 0 && 1 == 0", intMsg, true);
+    checkMatch("(1 == 1 || 1 == 0) && 1 == 0", intMsg, false);
+    checkMatch("!1 == 1", intMsg, false);
+    checkMatch("!(1 == 0) && !(1 == 0 || 1 == 0)", intMsg, true);
+    checkMatch("IntValues.field1 == 3 && IntValues.field2 == -10", intMsg, true);
+    checkMatch("IntValues.field1 == 4 || IntValues.field2 == -10", intMsg, true);
+
+    // Number comparisons
+    checkMatch("IntValues.field1 == 0x3", intMsg, true);
+    checkMatch("IntValues.field1 != 3", intMsg, false);
+    checkMatch("IntValues.field1 >= 3", intMsg, true);
+    checkMatch("IntValues.field1 > 3", intMsg, false);
+    checkMatch("IntValues.field2 < -5", intMsg, true);
+    checkMatch("IntValues.field2 <= -11", intMsg, false);
+    checkMatch("IntValues.field1 < 3.5", intMsg, true);
+    checkMatch("FloatValues.field1 > 1.5", floatMsg, true);
+    checkMatch("FloatValues.field1 == 2.5", floatMsg, true);
+    checkMatch("FloatValues.field1 < 2", floatMsg, false);
+
+    // String comparisons
+    checkMatch("Strings.field1 == \"hello\"", strMsg, true);
+    checkMatch("Strings.field1 != \"world\"", strMsg, true);
+    checkMatch("Strings.field1 < \"world\"", strMsg, true);
+    checkMatch("Strings.field1 contains \"ell\"", strMsg, true);
+    checkMatch("Strings.field1 contains \"world\"", strMsg, false);
+    checkMatch("Strings.field1 == \"he\\\"llo\"", strMsg, false);
+
+    // Field path without comparison
+    checkMatch("IntValues.field1", intMsg, true);
+    checkMatch("Strings.field1", strMsg, true);
+    checkMatch("Strings.field2", strMsg, false);
+    checkMatch("!Strings.field2", strMsg, true);
+
+    // Any message name
+    checkMatch("*.field1 == 3", intMsg, true);
+    checkMatch("*.field1 == 3", strMsg, false);
+    checkMatch("*.field1 contains \"hell\"", strMsg, true);
+
+    // Comparisons involving missing fields are always false
+    checkMatch("IntValues.field9 == 0", intMsg, false);
+    checkMatch("IntValues.field9 != 0", intMsg, false);
+    checkMatch("!(IntValues.field9 == 0)", intMsg, true);
+    checkMatch("IntValues.field1.member == 3", intMsg, false);
+    checkMatch("Strings.field1 == \"hello\"", intMsg, false);
+    checkMatch("IntValues.field1 == 3", strMsg, false);
+    checkMatch("IntValues.field9 == 0 || IntValues.field1 == 3", intMsg, true);
+
+    // The same compiled predicate evaluated on different messages
+    Predicate predicate;
+    if (!predicate.compile("IntValues.field1 == 3 || Strings.field1 == \"hello\"")) {
+        std::cerr << "FAILED: compile(): " << predicate.errorString().toStdString() << std::endl;
+        ++g_failures;
+    }
+    else {
+        auto copy = predicate;
+        if ((!predicate.matches(intMsg)) || (!predicate.matches(strMsg)) ||
+            predicate.matches(floatMsg) || (!copy.matches(strMsg))) {
+            std::cerr << "FAILED: reused predicate evaluation" << std::endl;
+            ++g_failures;
+        }
+    }
+
+    // Syntax errors
+    checkSyntaxError("IntValues.field1 ==");
+    checkSyntaxError("(IntValues.field1 == 3");
+    checkSyntaxError("IntValues.field1 == 3)");
+    checkSyntaxError("IntValues == 3");
+    checkSyntaxError("IntValues.field1 == \"abc");
+    checkSyntaxError("IntValues.field1 # 3");
+    checkSyntaxError("&& IntValues.field1");
+    checkSyntaxError("IntValues.field1 == 3 ||");
+    checkSyntaxError("IntValues.field1 == 12abc");
+    checkSyntaxError("IntValues[1]");
+    checkSyntaxError("3");
+
+    // Successful compilation clears the previous error
+    if ((predicate.compile("IntValues.field1 ==")) ||
+        (!predicate.compile("IntValues.field1 == 3")) ||
+        (!predicate.errorString().isEmpty())) {
+        std::cerr << "FAILED: error is not cleared by the successful compilation" << std::endl;
+        ++g_failures;
+    }
+
+    if (g_failures != 0U) {
+        std::cerr << g_failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
@@ -47,10 +47,25 @@ struct CC_TOOLS_API ToolsDataInfo
     /// @brief Type of extra properties storage
     using PropertiesMap = QVariantMap;
 
+    /// @brief Type of the data stream identifier
+    using StreamId = unsigned;
+
+    /// @brief Stream of the sockets not distinguishing their data sources
+    static constexpr StreamId DefaultStreamId = 0U;
+
     ToolsDataInfo();
+
+    /// @brief Add the properties to the @ref m_extraProperties.
+    /// @details When there are no extra properties yet, the provided map is
+    ///     shared (implicitly) rather than copied element by element, which
+    ///     allows sockets to prepare the properties once per endpoint.
+    void mergeExtraProperties(const PropertiesMap& props);
+
     Timestamp m_timestamp; ///< Timestamp when data has been received / sent
     DataSeq m_data; ///< Actual raw data
     PropertiesMap m_extraProperties; ///< Extra properties that can be used by other componets
+    StreamId m_streamId = DefaultStreamId; ///< Source of the received data (e.g. connection), each one is reassembled independently
+    bool m_streamEnd = false; ///< No more data is expected for the @ref m_streamId
 };
 
 /// @brief Pointer to @ref ToolsDataInfo
@@ -36,6 +36,7 @@ public:
     virtual ~ToolsFrame();
 
     ToolsMessagesList readData(const ToolsDataInfo& dataInfo, bool final);
+    ToolsMessagePtr readSingleMessage(const ToolsDataInfo& dataInfo);
     void updateMessage(ToolsMessage& msg);
     ToolsMessagePtr createInvalidMessage();
     ToolsMessagePtr createRawDataMessage();
@@ -48,6 +49,7 @@ protected:
     ToolsFrame() = default;
 
     virtual ToolsMessagesList readDataImpl(const ToolsDataInfo& dataInfo, bool final) = 0;
+    virtual ToolsMessagePtr readSingleMessageImpl(const ToolsDataInfo& dataInfo);
     virtual void updateMessageImpl(ToolsMessage& msg) = 0;
     virtual ToolsMessagePtr createInvalidMessageImpl() = 0;
     virtual ToolsMessagePtr createRawDataMessageImpl() = 0;
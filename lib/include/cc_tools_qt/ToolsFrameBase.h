@@ -20,6 +20,7 @@
 
 #include "cc_tools_qt/ToolsExtraInfoMessage.h"
 #include "cc_tools_qt/ToolsInvalidMessage.h"
+#include "cc_tools_qt/ToolsMsgPool.h"
 #include "cc_tools_qt/ToolsRawDataMessage.h"
 #include "cc_tools_qt/property/message.h"
 
@@ -31,6 +32,8 @@
 #include <cassert>
 #include <iterator>
 #include <iostream>
+#include <unordered_map>
+#include <utility>
 
 namespace cc_tools_qt
 {
@@ -60,34 +63,41 @@ public:
 protected:
     virtual ToolsMessagesList readDataImpl(const ToolsDataInfo& dataInfo, bool final) override
     {
-        m_inData.reserve(m_inData.size() + dataInfo.m_data.size());
-        m_inData.insert(m_inData.end(), dataInfo.m_data.begin(), dataInfo.m_data.end());
+        // Every stream has its own reassembly buffers, the partial frames
+        // of different sources (e.g. connections) do not interleave.
+        auto& context = m_streams[dataInfo.m_streamId];
+        auto& inData = context.m_inData;
+        auto& garbage = context.m_garbage;
+        final = final || dataInfo.m_streamEnd;
+
+        inData.reserve(inData.size() + dataInfo.m_data.size());
+        inData.insert(inData.end(), dataInfo.m_data.begin(), dataInfo.m_data.end());
 
         ToolsMessagesList allMsgs;
         std::size_t consumed = 0U;
 
         auto checkGarbageFunc =
-            [this, &allMsgs]()
+            [this, &allMsgs, &garbage]()
             {
-                if (m_garbage.empty()) {
+                if (garbage.empty()) {
                     return;
                 }
 
-                ToolsMessagePtr invalidMsgPtr(new InvalidMsg);
-                updateRawDataInternal(m_garbage, *invalidMsgPtr);
+                auto invalidMsgPtr = createAuxMsg<InvalidMsg>(AuxMsgType_Invalid);
+                updateRawDataInternal(garbage, *invalidMsgPtr);
                 allMsgs.push_back(std::move(invalidMsgPtr));
-                m_garbage.clear();
+                garbage.clear();
             };
 
 
         using ProtMsgPtr = typename ProtFrame::MsgPtr;
         using ReadIter = typename ProtInterface::ReadIterator;
-        while (consumed < m_inData.size()) {
+        while (consumed < inData.size()) {
             ProtMsgPtr msgPtr;
 
-            ReadIter readIterBeg = m_inData.data() + consumed;
+            ReadIter readIterBeg = inData.data() + consumed;
             ReadIter readIter = readIterBeg;
-            auto remLen = m_inData.size() - consumed;
+            auto remLen = inData.size() - consumed;
             assert(0U < remLen);
 
             qlonglong msgId = 0;
@@ -111,9 +121,9 @@ protected:
             }            
 
             if (es != comms::ErrorStatus::Success) {
-                m_garbage.push_back(*readIterBeg);
+                garbage.push_back(*readIterBeg);
                 static constexpr std::size_t GarbageLimit = 512;
-                if (GarbageLimit <= m_garbage.size()) {
+                if (GarbageLimit <= garbage.size()) {
                     checkGarbageFunc();
                 }
 
@@ -131,13 +141,14 @@ protected:
                 [[maybe_unused]] static constexpr bool Protocol_and_Tools_Frames_Out_of_Sync = false;
                 assert(Protocol_and_Tools_Frames_Out_of_Sync);
                 
-                m_garbage.reserve(m_garbage.size() + diff);
-                m_garbage.insert(m_garbage.end(), readIterBeg, readIter);
+                garbage.reserve(garbage.size() + diff);
+                garbage.insert(garbage.end(), readIterBeg, readIter);
                 checkGarbageFunc();
                 continue;
             }
 
             toolsMsg->assignProtMessage(msgPtr.get());
+            property::message::ToolsMsgIdx().setTo(static_cast<unsigned>(idx), *toolsMsg);
 
             DataSeq data(readIterBeg, readIter);
             updateTransportInternal(data, *toolsMsg);
@@ -147,31 +158,45 @@ protected:
 
         static_cast<void>(final);
         
-        assert(consumed <= m_inData.size());
-        m_inData.erase(m_inData.begin(), m_inData.begin() + consumed);
+        assert(consumed <= inData.size());
+        inData.erase(inData.begin(), inData.begin() + consumed);
 
-        if (final && (!m_inData.empty())) {
-            m_garbage.reserve(m_garbage.size() + m_inData.size());
-            m_garbage.insert(m_garbage.end(), m_inData.begin(), m_inData.end());
-            m_inData.clear();
+        if (final && (!inData.empty())) {
+            garbage.reserve(garbage.size() + inData.size());
+            garbage.insert(garbage.end(), inData.begin(), inData.end());
+            inData.clear();
             checkGarbageFunc();
         }        
 
-        if (!dataInfo.m_extraProperties.isEmpty()) {
-            auto jsonObj = QJsonObject::fromVariantMap(dataInfo.m_extraProperties);
-            QJsonDocument doc(jsonObj);
-            auto jsonData = doc.toJson();
-            DataSeq jsonRawBytes(jsonData.begin(), jsonData.end());
+        if (final && (dataInfo.m_streamId != ToolsDataInfo::DefaultStreamId)) {
+            m_streams.erase(dataInfo.m_streamId);
+        }
 
+        // The extra info message is created on demand, see ToolsProtocol::createExtraInfoMsgIfNeeded()
+        if (!dataInfo.m_extraProperties.isEmpty()) {
             for (auto& m : allMsgs) {
                 property::message::ToolsMsgExtraInfo().setTo(dataInfo.m_extraProperties, *m);
-                updateExtraInfoInternal(jsonRawBytes, *m);
             }
         }
 
         return allMsgs;
     }
 
+    virtual ToolsMessagePtr readSingleMessageImpl(const ToolsDataInfo& dataInfo) override
+    {
+        // Decode the complete frame without affecting the pending input
+        StreamsMap streams;
+        std::swap(streams, m_streams);
+        auto msgs = readDataImpl(dataInfo, true);
+        std::swap(streams, m_streams);
+
+        if (msgs.empty()) {
+            return ToolsMessagePtr();
+        }
+
+        return msgs.front();
+    }
+
     virtual void updateMessageImpl(ToolsMessage& msg) override
     {
         auto data = msg.encodeFramed(*this);
@@ -185,9 +210,8 @@ protected:
             return;
         }
 
-        auto extraInfoMsgPtr = std::make_unique<ExtraInfoMsg>();
         if (extraProps.isEmpty()) {
-            property::message::ToolsMsgExtraInfoMsg().setTo(ToolsMessagePtr(extraInfoMsgPtr.release()), msg);
+            property::message::ToolsMsgExtraInfoMsg().setTo(createAuxMsg<ExtraInfoMsg>(AuxMsgType_ExtraInfo), msg);
             return;
         }        
 
@@ -200,17 +224,17 @@ protected:
 
     virtual ToolsMessagePtr createInvalidMessageImpl() override
     {
-        return ToolsMessagePtr(new InvalidMsg());
+        return createAuxMsg<InvalidMsg>(AuxMsgType_Invalid);
     }
 
     virtual ToolsMessagePtr createRawDataMessageImpl() override
     {
-        return ToolsMessagePtr(new RawDataMsg());
+        return createAuxMsg<RawDataMsg>(AuxMsgType_RawData);
     }    
 
     virtual ToolsMessagePtr createExtraInfoMessageImpl() override
     {
-        return ToolsMessagePtr(new ExtraInfoMsg());
+        return createAuxMsg<ExtraInfoMsg>(AuxMsgType_ExtraInfo);
     }
 
     virtual ToolsMessagesList createAllMessagesImpl() override
@@ -247,9 +271,30 @@ protected:
     }
 
 private:
+    // Types of the auxiliary messages recycled via the pool
+    enum AuxMsgType : std::size_t
+    {
+        AuxMsgType_Invalid,
+        AuxMsgType_Transport,
+        AuxMsgType_RawData,
+        AuxMsgType_ExtraInfo,
+        AuxMsgType_NumOfValues
+    };
+
+    template <typename TMsg>
+    ToolsMessagePtr createAuxMsg(AuxMsgType type)
+    {
+        auto msg = m_auxMsgPool->take(type);
+        if (!msg) {
+            msg.reset(new TMsg);
+        }
+
+        return m_auxMsgPool->wrap(type, std::move(msg));
+    }
+
     void updateTransportInternal(const DataSeq& data, ToolsMessage& msg)
     {
-        ToolsMessagePtr transportMsg(new TransportMsg);
+        auto transportMsg = createAuxMsg<TransportMsg>(AuxMsgType_Transport);
         if (!transportMsg->decodeData(data)) {
             std::cerr << "ERROR: Failed to decode transport message: " << std::hex;
             std::copy(data.begin(), data.end(), std::ostream_iterator<unsigned>(std::cerr, " "));
@@ -264,7 +309,7 @@ private:
 
     void updateRawDataInternal(const DataSeq& data, ToolsMessage& msg)
     {
-        ToolsMessagePtr rawDataMsg(new RawDataMsg);
+        auto rawDataMsg = createAuxMsg<RawDataMsg>(AuxMsgType_RawData);
         if (!rawDataMsg->decodeData(data)) {
             std::cerr << "ERROR: Failed to decode raw data message: " << std::hex;
             std::copy(data.begin(), data.end(), std::ostream_iterator<unsigned>(std::cerr, " "));
@@ -275,11 +320,12 @@ private:
         }    
         
         property::message::ToolsMsgRawDataMsg().setTo(std::move(rawDataMsg), msg);   
+        property::message::ToolsMsgFrameSize().setTo(static_cast<unsigned>(data.size()), msg);
     }    
 
     void updateExtraInfoInternal(const DataSeq& jsonRawBytes, ToolsMessage& msg)
     {
-        ToolsMessagePtr extraInfoMsg(new ExtraInfoMsg);
+        auto extraInfoMsg = createAuxMsg<ExtraInfoMsg>(AuxMsgType_ExtraInfo);
         if (!extraInfoMsg->decodeData(jsonRawBytes)) {
             std::cerr << "ERROR: Failed to decode extra info:\n";
             std::copy(jsonRawBytes.begin(), jsonRawBytes.end(), std::ostream_iterator<char>(std::cerr, " "));
@@ -292,10 +338,18 @@ private:
         property::message::ToolsMsgExtraInfoMsg().setTo(std::move(extraInfoMsg), msg);        
     }     
 
+    struct StreamContext
+    {
+        DataSeq m_inData;
+        DataSeq m_garbage;
+    };
+
+    using StreamsMap = std::unordered_map<ToolsDataInfo::StreamId, StreamContext>;
+
     ProtFrame m_frame;
     TMsgFactory m_factory;
-    DataSeq m_inData;
-    DataSeq m_garbage;
+    StreamsMap m_streams;
+    ToolsMsgPoolPtr m_auxMsgPool = std::make_shared<ToolsMsgPool>(AuxMsgType_NumOfValues);
 };
 
 }  // namespace cc_tools_qt
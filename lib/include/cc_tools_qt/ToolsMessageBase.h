@@ -151,10 +151,13 @@ protected:
     }
 
     /// @brief Overriding implementation to cc_tools_qt::ToolsMessage::resetImpl()
+    /// @details Copy assigns the default protocol message in place, which
+    ///     reuses the storage of the fields and does not construct a
+    ///     temporary message object.
     virtual void resetImpl() override
     {
-        auto& actObj = static_cast<TActualMsg&>(*this);
-        actObj = TActualMsg();
+        static const ProtMsg DefaultMsg;
+        m_msg = DefaultMsg;
     }    
 
     /// @brief Overriding polymorphic assignment
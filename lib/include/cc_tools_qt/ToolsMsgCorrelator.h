@@ -0,0 +1,145 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QString>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+/// @brief Request / response correlation with the round trip latency statistics.
+/// @details The sent requests are paired with the received responses according
+///     to the configured rules. Every rule specifies the request and response
+///     message IDs as well as optional field paths (@b field.member or
+///     @b list[2].member, names compared ignoring whitespaces) of the
+///     correlation key, such as sequence or transaction number. The payload
+///     fields are searched first, then the transport ones. The key values are
+///     compared by their serialised form. Without the field path the
+///     responses are paired with the requests in the order of sending.
+///
+///     The messages are expected to have the type and timestamp properties set,
+///     i.e. the same object can be updated live or process a loaded capture.
+/// @headerfile cc_tools_qt/ToolsMsgCorrelator.h
+class CC_TOOLS_API ToolsMsgCorrelator
+{
+public:
+    /// @brief Type of the timestamp, milliseconds same as the message timestamp property
+    using TimestampType = unsigned long long;
+
+    /// @brief Correlation rule
+    struct Rule
+    {
+        qlonglong m_reqId = 0; ///< Numeric ID of the request message
+        qlonglong m_rspId = 0; ///< Numeric ID of the response message
+        QString m_reqKeyPath; ///< Path of the key field in the request, empty for in-order pairing
+        QString m_rspKeyPath; ///< Path of the key field in the response, empty means same as request
+    };
+
+    /// @brief List of rules
+    using RulesList = std::vector<Rule>;
+
+    /// @brief Single bucket of the latency histogram
+    struct HistogramBucket
+    {
+        TimestampType m_from = 0U; ///< Lowest latency (inclusive)
+        TimestampType m_to = 0U; ///< Highest latency (inclusive)
+        unsigned long long m_count = 0U; ///< Number of responses
+    };
+
+    /// @brief Latency histogram, only the non-empty buckets in increasing order
+    using Histogram = std::vector<HistogramBucket>;
+
+    /// @brief Statistics of a single rule
+    struct Stats
+    {
+        unsigned long long m_requests = 0U; ///< Number of the sent requests
+        unsigned long long m_matched = 0U; ///< Number of the responses paired within timeout
+        unsigned long long m_timeouts = 0U; ///< Number of the requests not responded within timeout
+        unsigned long long m_unmatched = 0U; ///< Number of the responses without pending request
+        unsigned long long m_pending = 0U; ///< Number of the requests still waiting for response
+        TimestampType m_maxLatency = 0U; ///< Maximal round trip latency
+    };
+
+    ToolsMsgCorrelator();
+    ~ToolsMsgCorrelator() noexcept;
+
+    ToolsMsgCorrelator(const ToolsMsgCorrelator&) = delete;
+    ToolsMsgCorrelator& operator=(const ToolsMsgCorrelator&) = delete;
+
+    /// @brief Set the correlation rules, clears the gathered statistics.
+    void setRules(RulesList&& rules);
+
+    /// @brief Retrieve the correlation rules.
+    const RulesList& rules() const;
+
+    /// @brief Set the response timeout in milliseconds, 0 disables the timeouts.
+    void setTimeout(TimestampType timeoutMs);
+
+    /// @brief Retrieve the response timeout.
+    TimestampType timeout() const;
+
+    /// @brief Account the sent or received message.
+    void addMsg(ToolsMessage& msg);
+
+    /// @brief Process the whole loaded capture, clears the previous statistics.
+    /// @details The pending requests are expired at the latest timestamp
+    ///     of the processed messages.
+    void process(const ToolsMessagesList& msgs);
+
+    /// @brief Count the pending requests older than the timeout at @b now.
+    void expire(TimestampType now);
+
+    /// @brief Count the pending requests older than the timeout at the latest
+    ///     timestamp of the accounted messages.
+    /// @details Allows processing of the capture in parts using clear(),
+    ///     addMsg() and this function.
+    void expireAccounted();
+
+    /// @brief Drop all the gathered statistics, the rules are kept.
+    void clear();
+
+    /// @brief Retrieve statistics of the rule.
+    const Stats& stats(std::size_t ruleIdx) const;
+
+    /// @brief Retrieve latency percentile of the rule.
+    /// @param[in] ruleIdx Index of the rule.
+    /// @param[in] percent Percent in [0, 100] range, e.g. 50 for median.
+    /// @return Upper bound of the histogram bucket where the percentile resides,
+    ///     not greater than the maximal latency.
+    TimestampType latencyPercentile(std::size_t ruleIdx, double percent) const;
+
+    /// @brief Retrieve latency histogram of the rule.
+    Histogram histogram(std::size_t ruleIdx) const;
+
+    /// @brief Number of the statistics updates, allows detection of the changes.
+    unsigned long long updatesCount() const;
+
+private:
+    struct InnerState;
+    std::unique_ptr<InnerState> m_state;
+};
+
+}  // namespace cc_tools_qt
@@ -20,8 +20,13 @@
 
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgPool.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QString>
 
 #include <list>
+#include <utility>
 #include <vector>
 
 namespace cc_tools_qt
@@ -42,10 +47,26 @@ protected:
     ToolsMsgFactory();
     virtual MessagesListInternal createAllMessagesImpl() = 0;
 
+    /// @brief Create message object of the type, which resides at the
+    ///     specified index in the list returned by createAllMessagesImpl().
+    /// @details Default implementation clones the default message object.
+    ///     The created objects are recycled via the internal pool.
+    virtual ToolsMessage::Ptr createMessageImpl(std::size_t typeIdx);
+
 private:
+    using IdRange = std::pair<unsigned, unsigned>; // first index, count
+    using IdRangesTable = std::vector<IdRange>;
+
     void createDefaultMessagesIfNeeded();
+    IdRange findIdRange(qlonglong id) const;
+    ToolsMessagePtr createPooledMessage(std::size_t typeIdx);
 
     MessagesListInternal m_defaultMsgs;  
+    std::vector<qlonglong> m_ids;
+    IdRangesTable m_denseIdRanges;
+    qlonglong m_minId = 0;
+    QHash<QString, qlonglong> m_parsedIds;
+    ToolsMsgPoolPtr m_pool;
 };
 
 }  // namespace cc_tools_qt
@@ -22,6 +22,8 @@
 
 #include "comms/util/Tuple.h"
 
+#include <array>
+#include <cassert>
 #include <tuple>
 
 namespace cc_tools_qt
@@ -51,6 +53,29 @@ private:
     MessagesListInternal& m_msgs;
 };
 
+template <typename TAllMessages>
+class TupleMsgCreateHelper;
+
+template <typename... TMsgs>
+class TupleMsgCreateHelper<std::tuple<TMsgs...> >
+{
+public:
+    static ToolsMessage::Ptr create(std::size_t typeIdx)
+    {
+        using CreateFunc = ToolsMessage::Ptr (*)();
+        static const std::array<CreateFunc, sizeof...(TMsgs)> Funcs = {{&createMsg<TMsgs>...}};
+        assert(typeIdx < Funcs.size());
+        return Funcs[typeIdx]();
+    }
+
+private:
+    template <typename TMsg>
+    static ToolsMessage::Ptr createMsg()
+    {
+        return ToolsMessage::Ptr(new TMsg);
+    }
+};
+
 }  // namespace details
 
 template <typename TAllMessages>
@@ -68,6 +93,11 @@ protected:
         comms::util::tupleForEachType<TAllMessages>(details::TupleMsgFactoryHelper(result));
         return result;
     }
+
+    virtual ToolsMessage::Ptr createMessageImpl(std::size_t typeIdx) override
+    {
+        return details::TupleMsgCreateHelper<TAllMessages>::create(typeIdx);
+    }
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,100 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QString>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+/// @brief Inverted index over the decoded field values of the messages.
+/// @details The messages are queued and their field values are extracted
+///     and indexed by the background thread in the order of their addition,
+///     the added message numbers are expected to be increasing. The fields of
+///     the queued messages are only read and must not be modified, use
+///     @ref updateMsg() to reindex the changed message.
+///     The string field values, enum value names, message names and comments
+///     are split into case insensitive word tokens, the numeric field values are stored
+///     in the per field path sorted columns. Supported query terms, separated
+///     by whitespaces, all of which must match:
+///     @li Word: @b token or @b prefix*
+///     @li Numeric: @b MsgName.field.member followed by one of
+///         =, ==, <, <=, >, >= and the value, or by =min..max for the range.
+///         @b * instead of message name matches any message. The list elements
+///         are referenced without the index.
+/// @headerfile cc_tools_qt/ToolsMsgIndex.h
+class CC_TOOLS_API ToolsMsgIndex
+{
+public:
+    /// @brief Type of the message number
+    using MsgNumberType = unsigned long long;
+
+    /// @brief Sorted list of message numbers
+    using MsgNumbersList = std::vector<MsgNumberType>;
+
+    /// @brief Constructor, starts the indexing thread
+    ToolsMsgIndex();
+
+    /// @brief Destructor, stops the indexing thread
+    ~ToolsMsgIndex() noexcept;
+
+    ToolsMsgIndex(const ToolsMsgIndex&) = delete;
+    ToolsMsgIndex& operator=(const ToolsMsgIndex&) = delete;
+
+    /// @brief Queue the message for indexing.
+    /// @details The comment is read before the return, the reference to the
+    ///     message is kept until its fields are read by the indexing thread.
+    void addMsg(MsgNumberType msgNum, ToolsMessagePtr msg);
+
+    /// @brief Queue the message for reindexing.
+    /// @details Drops the previously indexed values of the message number
+    ///     and indexes the message again, see @ref addMsg().
+    void updateMsg(MsgNumberType msgNum, ToolsMessagePtr msg);
+
+    /// @brief Queue the removal of the message from the index.
+    void removeMsg(MsgNumberType msgNum);
+
+    /// @brief Drop all the indexed and queued messages.
+    /// @details Waits for the indexing of the messages in progress to complete,
+    ///     no references to the queued messages remain after the return.
+    void clear();
+
+    /// @brief Number of messages waiting for indexing.
+    std::size_t pendingCount() const;
+
+    /// @brief Search the index.
+    /// @param[in] query Query string.
+    /// @param[out] result Sorted numbers of the matching messages.
+    /// @param[out] error Error description in case of invalid query.
+    /// @return @b true on success, @b false on invalid query.
+    bool search(const QString& query, MsgNumbersList& result, QString& error);
+
+private:
+    struct InnerState;
+    std::unique_ptr<InnerState> m_state;
+};
+
+}  // namespace cc_tools_qt
@@ -21,9 +21,13 @@
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsFilter.h"
 #include "cc_tools_qt/ToolsMessage.h"
+#include "cc_tools_qt/ToolsMsgCorrelator.h"
+#include "cc_tools_qt/ToolsMsgIndex.h"
+#include "cc_tools_qt/ToolsMsgStats.h"
 #include "cc_tools_qt/ToolsProtocol.h"
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include <cstddef>
 #include <memory>
 #include <list>
 #include <vector>
@@ -58,6 +62,48 @@ public:
     const ToolsMessagesList& getAllMsgs() const;
     void addMsgs(const ToolsMessagesList& msgs, bool reportAdded = true);
 
+    // In the compact history mode only the raw frame data with some metadata
+    // is stored, the messages are decoded on request by getMsg() and
+    // getAllMsgs() returns empty list.
+    void setCompactHistoryEnabled(bool enabled);
+    bool isCompactHistoryEnabled() const;
+    std::size_t getMsgsCount() const;
+    ToolsMessagePtr getMsg(std::size_t idx);
+    void updateMsgComment(const ToolsMessage& msg);
+
+    // The search index is built by the background thread out of the field
+    // values of the stored messages, see ToolsMsgIndex for the query syntax.
+    // The found message numbers are resolved into the messages by findMsgs(),
+    // the deleted ones are skipped.
+    using MsgNumberType = ToolsMsgIndex::MsgNumberType;
+    using MsgNumbersList = ToolsMsgIndex::MsgNumbersList;
+    void setSearchIndexEnabled(bool enabled);
+    bool isSearchIndexEnabled() const;
+    bool searchMsgs(const QString& query, MsgNumbersList& result, QString& error);
+    ToolsMessagesList findMsgs(const MsgNumbersList& msgNums);
+
+    // Resolves single stored message by its number, decodes it in the compact
+    // mode. Returns empty pointer if the message has been deleted.
+    ToolsMessagePtr findMsg(MsgNumberType msgNum);
+    void deleteMsgs(const MsgNumbersList& msgNums);
+
+    // Number assigned to the message when stored, the numbers are increasing
+    // in the order of storage and survive the decoding of the compact history.
+    static MsgNumberType getMsgNumber(const ToolsMessage& msg);
+
+    // Traffic statistics of the messages sent and received since
+    // the last clearStats(), the loaded messages are not accounted.
+    const ToolsMsgStats& getStats() const;
+    void clearStats();
+
+    // Request / response correlation of the messages sent and received
+    // live, configure its rules before the traffic starts.
+    ToolsMsgCorrelator& getCorrelator();
+
+    // Re-evaluates the correlation over all the stored messages (e.g. the
+    // loaded capture), the previous statistics are dropped.
+    void correlateStoredMsgs();
+
     void setSocket(ToolsSocketPtr socket);
     void setProtocol(ToolsProtocolPtr protocol);
     void addFilter(ToolsFilterPtr filter);
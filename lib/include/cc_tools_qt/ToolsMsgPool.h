@@ -0,0 +1,77 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QThread>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+/// @brief Pool of the message objects recycled per message type.
+/// @details The message objects wrapped by the @ref wrap() function are
+///     not destructed when the last @ref ToolsMessagePtr referencing them
+///     is released, instead they are reset and kept for reuse. The objects
+///     are destructed normally if the pool itself is already destructed.
+///     The pool is not thread safe, it is used only on the thread that
+///     created the pool (the GUI one). The objects released on any other
+///     thread are destructed normally and the @ref take() function
+///     invoked on any other thread returns an empty pointer. Note that
+///     the received messages are kept in the history, hence only the
+///     discarded ones (e.g. filtered out or cleared) get recycled.
+/// @headerfile cc_tools_qt/ToolsMsgPool.h
+class CC_TOOLS_API ToolsMsgPool : public std::enable_shared_from_this<ToolsMsgPool>
+{
+public:
+    /// @brief Maximum number of kept objects per message type
+    static const std::size_t MaxPooledPerType = 256U;
+
+    /// @brief Constructor
+    /// @param[in] typesCount Number of supported message types.
+    explicit ToolsMsgPool(std::size_t typesCount);
+
+    /// @brief Destructor
+    ~ToolsMsgPool() noexcept;
+
+    /// @brief Take previously recycled message object.
+    /// @return Recycled message object or empty pointer if there is none
+    ///     or the function is invoked not on the pool's thread.
+    ToolsMessage::Ptr take(std::size_t typeIdx);
+
+    /// @brief Wrap the message object, so it is recycled when released.
+    ToolsMessagePtr wrap(std::size_t typeIdx, ToolsMessage::Ptr msg);
+
+private:
+    void recycle(std::size_t typeIdx, ToolsMessage* msg);
+
+    std::vector<std::vector<ToolsMessage::Ptr> > m_free;
+    QThread* m_thread = nullptr;
+};
+
+/// @brief Pointer to @ref ToolsMsgPool object.
+using ToolsMsgPoolPtr = std::shared_ptr<ToolsMsgPool>;
+
+}  // namespace cc_tools_qt
+
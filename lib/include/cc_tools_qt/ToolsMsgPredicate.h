@@ -0,0 +1,92 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QString>
+
+#include <memory>
+
+namespace cc_tools_qt
+{
+
+/// @brief Predicate on the message field values.
+/// @details The expression is parsed once by @ref compile() and then
+///     evaluated by @ref matches() directly on the message fields without
+///     any widgets involved. Supported syntax:
+///     @li Field path: @b MsgName.field.member or @b MsgName.list[2].member,
+///         @b * instead of message name matches any message. The names are
+///         compared ignoring whitespaces.
+///     @li Literals: integral (including hex), floating point, "string".
+///     @li Comparison: ==, !=, <, <=, >, >=, contains.
+///     @li Logical: &&, ||, ! and parentheses.
+///     @li Field path without comparison is @b true when the field exists
+///         and its value is non-zero / non-empty.
+///
+///     Comparison involving non-existing field is always @b false.
+///     The object caches the fields lookup information while evaluating,
+///     use separate copies when evaluating in multiple threads.
+/// @headerfile cc_tools_qt/ToolsMsgPredicate.h
+class CC_TOOLS_API ToolsMsgPredicate
+{
+public:
+    /// @brief Constructor
+    ToolsMsgPredicate();
+
+    /// @brief Copy constructor
+    ToolsMsgPredicate(const ToolsMsgPredicate& other);
+
+    /// @brief Move constructor
+    ToolsMsgPredicate(ToolsMsgPredicate&& other) noexcept;
+
+    /// @brief Destructor
+    ~ToolsMsgPredicate() noexcept;
+
+    /// @brief Copy assignment
+    ToolsMsgPredicate& operator=(const ToolsMsgPredicate& other);
+
+    /// @brief Move assignment
+    ToolsMsgPredicate& operator=(ToolsMsgPredicate&& other) noexcept;
+
+    /// @brief Parse the expression.
+    /// @details Empty expression matches all the messages.
+    /// @return @b true on success, @b false on syntax error, the error
+    ///     description can be retrieved using @ref errorString().
+    bool compile(const QString& expr);
+
+    /// @brief Retrieve the compiled expression.
+    const QString& expression() const;
+
+    /// @brief Retrieve the error of the last @ref compile().
+    const QString& errorString() const;
+
+    /// @brief Check the compiled expression is empty.
+    bool isEmpty() const;
+
+    /// @brief Evaluate the predicate on the message.
+    bool matches(ToolsMessage& msg);
+
+private:
+    struct InnerState;
+    std::unique_ptr<InnerState> m_state;
+};
+
+}  // namespace cc_tools_qt
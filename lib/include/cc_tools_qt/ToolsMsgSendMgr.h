@@ -31,17 +31,80 @@ class ToolsMsgSendMgrImpl;
 class CC_TOOLS_API ToolsMsgSendMgr
 {
 public:
+    /// @brief Configuration of the load generation
+    struct LoadConfig
+    {
+        /// @brief Units of the target rate
+        enum class RateUnits
+        {
+            Messages, ///< Messages per second
+            Bytes, ///< Bytes per second
+            NumOfValues ///< Number of available values
+        };
+
+        unsigned long long m_rate = 0U; ///< Target rate, 0 means as fast as possible
+        RateUnits m_rateUnits = RateUnits::Messages; ///< Units of the target rate
+        unsigned m_burstSize = 1U; ///< Number of messages sent back to back
+        unsigned long long m_durationMs = 0U; ///< Duration limit, 0 means unlimited
+    };
+
+    /// @brief Live statistics of the load generation
+    struct LoadStats
+    {
+        unsigned long long m_elapsedMs = 0U; ///< Time since the load generation start
+        unsigned long long m_sentMsgs = 0U; ///< Total number of sent messages
+        unsigned long long m_sentBytes = 0U; ///< Total number of sent bytes
+        double m_msgsRate = 0.0; ///< Achieved messages per second since last report
+        double m_bytesRate = 0.0; ///< Achieved bytes per second since last report
+        unsigned long long m_queueDepth = 0U; ///< Number of due messages not sent yet
+    };
+
+    /// @brief Configuration of the capture replay
+    struct ReplayConfig
+    {
+        double m_speed = 1.0; ///< Replay speed factor, 0 means as fast as possible
+    };
+
+    /// @brief Live statistics of the capture replay
+    struct ReplayStats
+    {
+        unsigned long long m_elapsedMs = 0U; ///< Time since the replay start
+        unsigned long long m_sentMsgs = 0U; ///< Number of sent messages
+        unsigned long long m_totalMsgs = 0U; ///< Total number of messages to replay
+        unsigned long long m_lagMs = 0U; ///< How far behind the schedule the last sent message was
+        unsigned long long m_maxLagMs = 0U; ///< Maximal detected lag
+    };
+
     using SendMsgsCallbackFunc = std::function<void (ToolsMessagesList&&)>;
     using SendCompleteCallbackFunc = std::function<void ()>;
+    using LoadStatsReportCallbackFunc = std::function<void (const LoadStats&)>;
+    using ReplayStatsReportCallbackFunc = std::function<void (const ReplayStats&)>;
 
     ToolsMsgSendMgr();
     ~ToolsMsgSendMgr() noexcept;
 
     void setSendMsgsCallbackFunc(SendMsgsCallbackFunc&& func);
     void setSendCompeteCallbackFunc(SendCompleteCallbackFunc&& func);
+    void setLoadStatsReportCallbackFunc(LoadStatsReportCallbackFunc&& func);
+    void setReplayStatsReportCallbackFunc(ReplayStatsReportCallbackFunc&& func);
 
     void start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs);
 
+    /// @brief Start sending provided messages in a loop at the configured rate.
+    /// @details The delay / repeat properties of the messages are ignored,
+    ///     the statistics are reported periodically via callback set by
+    ///     @ref setLoadStatsReportCallbackFunc().
+    void startLoad(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const LoadConfig& config);
+
+    /// @brief Replay provided messages at the configured speed.
+    /// @details The delays of the messages are accumulated into absolute
+    ///     send times, which are scaled by the speed factor. Every send is
+    ///     scheduled against the absolute time since the replay start, so
+    ///     the timer inaccuracies do not accumulate. The repeat properties
+    ///     of the messages are ignored. The statistics are reported
+    ///     periodically via callback set by @ref setReplayStatsReportCallbackFunc().
+    void startReplay(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const ReplayConfig& config);
+
     void stop();
 
 private:
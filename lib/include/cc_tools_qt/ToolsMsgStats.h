@@ -0,0 +1,106 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsMessage.h"
+
+#include <QtCore/QString>
+
+#include <cstddef>
+#include <memory>
+
+namespace cc_tools_qt
+{
+
+/// @brief Live traffic statistics of the sent and received messages.
+/// @details Every added message updates the statistics of its ID, index and
+///     direction in constant time. The rates are counted in per second
+///     buckets covering the last minute. Messages without ID (garbage)
+///     are counted separately.
+/// @headerfile cc_tools_qt/ToolsMsgStats.h
+class CC_TOOLS_API ToolsMsgStats
+{
+public:
+    /// @brief Type of the timestamp, milliseconds same as the message timestamp property
+    using TimestampType = unsigned long long;
+
+    /// @brief Rate windows
+    enum RateWindow
+    {
+        RateWindow_1s, ///< Last second
+        RateWindow_10s, ///< Last 10 seconds
+        RateWindow_60s, ///< Last minute
+        RateWindow_NumOfValues ///< Number of available values
+    };
+
+    /// @brief Statistics of the single message type in a single direction
+    struct Entry
+    {
+        QString m_name;
+        qlonglong m_id = 0;
+        unsigned m_idx = 0U;
+        ToolsMessage::Type m_type = ToolsMessage::Type::Invalid;
+        unsigned long long m_count = 0U;
+        unsigned long long m_bytes = 0U;
+        unsigned long long m_invalidCount = 0U;
+        TimestampType m_lastSeen = 0U;
+    };
+
+    ToolsMsgStats();
+    ~ToolsMsgStats() noexcept;
+
+    ToolsMsgStats(const ToolsMsgStats&) = delete;
+    ToolsMsgStats& operator=(const ToolsMsgStats&) = delete;
+
+    /// @brief Account the sent or received message.
+    /// @param[in] msg Message with the type and timestamp properties set.
+    /// @param[in] bytes Number of the message bytes on the link.
+    void addMsg(const ToolsMessage& msg, std::size_t bytes);
+
+    /// @brief Drop all the gathered statistics.
+    void clear();
+
+    /// @brief Number of the entries, new ones are appended in the order of appearance.
+    std::size_t entriesCount() const;
+
+    /// @brief Access the entry.
+    const Entry& entry(std::size_t idx) const;
+
+    /// @brief Average rate of the entry messages per second over the window ending at @b now.
+    double rate(std::size_t idx, RateWindow window, TimestampType now) const;
+
+    /// @brief Number of garbage messages.
+    unsigned long long garbageCount() const;
+
+    /// @brief Number of garbage bytes.
+    unsigned long long garbageBytes() const;
+
+    /// @brief Number of the statistics updates, allows detection of the changes.
+    unsigned long long updatesCount() const;
+
+    /// @brief Current time in the units of the message timestamps.
+    static TimestampType now();
+
+private:
+    struct InnerState;
+    std::unique_ptr<InnerState> m_state;
+};
+
+}  // namespace cc_tools_qt
@@ -92,6 +92,9 @@ public:
     ~ToolsPluginMgr() noexcept;
 
     void setPluginsDir(const QString& pluginDir);
+    // File caching the metadata of the plugins, allows getAvailablePlugins()
+    // to skip reading the libraries which haven't changed since.
+    void setCacheFile(const QString& filename);
     const ListOfPluginInfos& getAvailablePlugins();
     const ListOfPluginInfos& getAppliedPlugins() const;
     void setAppliedPlugins(const ListOfPluginInfos& plugins);
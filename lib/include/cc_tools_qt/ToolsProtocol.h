@@ -31,6 +31,7 @@
 #include <cstddef>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace cc_tools_qt
 {
@@ -50,6 +51,18 @@ public:
     /// @brief Type used to contain raw bytes seqence
     using MsgDataSeq = ToolsMessage::DataSeq ;
 
+    /// @brief Summary of a single message type supported by the protocol.
+    struct MsgCatalogEntry
+    {
+        QString m_name; ///< Name of the message
+        QString m_idAsString; ///< String representation of the message ID
+        qlonglong m_id = 0; ///< Numeric message ID
+        unsigned m_idx = 0U; ///< Index of the message type within the same ID
+    };
+
+    /// @brief Catalog of the message types, in the order of @ref createAllMessages().
+    using MsgCatalog = std::vector<MsgCatalogEntry>;
+
     /// @brief Status of message "update" operation.
     enum class UpdateStatus
     {
@@ -70,6 +83,13 @@ public:
     /// @return List of created messages
     ToolsMessagesList read(const ToolsDataInfo& dataInfo, bool final = false);
 
+    /// @brief Decode previously received complete frame.
+    /// @details Unlike @ref read(), does not affect the state of the
+    ///     input processing.
+    /// @param[in] dataInfo Frame data information
+    /// @return Decoded message, may be empty if not supported by the frame.
+    ToolsMessagePtr decodeMessage(const ToolsDataInfo& dataInfo);
+
     /// @brief Serialise message.
     /// @param[in] msg Reference to message object, passed by non-const reference
     ///     to allow update of the message properties.
@@ -79,6 +99,22 @@ public:
     /// @brief Create all messages supported by the protocol.
     ToolsMessagesList createAllMessages();
 
+    /// @brief Retrieve catalog of all the messages supported by the protocol.
+    /// @details Built on the first access without encoding any message, unlike
+    ///     @ref createAllMessages(). The catalog is cached until
+    ///     @ref invalidateMsgCatalog() or @ref applyInterPluginConfig() is invoked.
+    const MsgCatalog& msgCatalog();
+
+    /// @brief Create message of the catalog entry.
+    /// @details The created message is the same as the corresponding one
+    ///     returned by @ref createAllMessages().
+    /// @param[in] idx Index of the entry in the @ref msgCatalog().
+    /// @return Message object, empty if the index is out of range.
+    ToolsMessagePtr createCatalogMessage(std::size_t idx);
+
+    /// @brief Drop the cached catalog, it is rebuilt on the next access.
+    void invalidateMsgCatalog();
+
     /// @brief Create message object given string representation of the message ID.
     /// @param[in] idAsString String representation of the message ID.
     /// @param[in] idx Index of the message type within the range of message types
@@ -89,10 +125,30 @@ public:
     /// @return Status of the update.
     UpdateStatus updateMessage(ToolsMessage& msg);
 
+    /// @brief Create the "extra info message" out of the "extra info" properties.
+    /// @details The decoded messages carry only the "extra info" properties,
+    ///     the message for their display is expected to be created on demand.
+    ///     Does nothing when the message already exists or there is no extra info.
+    void createExtraInfoMsgIfNeeded(ToolsMessage& msg);
+
+    /// @brief Merge the "extra info" properties into the message.
+    /// @details Unlike @ref updateMessage(), does not touch the frame data
+    ///     and keeps the cached encoded data. The "extra info message" is
+    ///     dropped to be re-created by @ref createExtraInfoMsgIfNeeded().
+    /// @param[in] extraInfo Properties to merge.
+    /// @param[in, out] msg Message object.
+    void mergeExtraInfo(const QVariantMap& extraInfo, ToolsMessage& msg);
+
     /// @brief Clone the message object
     /// @return Pointer to newly created message with the same contents
     ToolsMessagePtr cloneMessage(const ToolsMessage& msg);
 
+    /// @brief Serialise message once and cache the result in the message properties.
+    /// @details The cached data is reused by @ref write() and shared with the
+    ///     clones created by @ref cloneMessage() until the message gets
+    ///     modified and @ref updateMessage() is invoked.
+    void cacheEncodedData(ToolsMessage& msg);
+
     /// @brief Create dummy message containing invalid input
     ToolsMessagePtr createInvalidMessage(const MsgDataSeq& data);
 
@@ -225,6 +281,10 @@ protected slots:
     void reportInterPluginConfig(const QVariantMap& props);     
 
 private:
+    ToolsDataInfoPtr encodeInternal(ToolsMessage& msg);
+    void prepareCreatedMessage(ToolsMessage& msg, unsigned idx);
+    void updateExtraInfoMsg(const QVariantMap& extraInfo, ToolsMessage& msg);
+
     struct InnerState;
     std::unique_ptr<InnerState> m_state;
 };
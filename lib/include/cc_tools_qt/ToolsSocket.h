@@ -21,6 +21,8 @@
 #include "cc_tools_qt/ToolsApi.h"
 #include "cc_tools_qt/ToolsDataInfo.h"
 
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 
@@ -95,6 +97,12 @@ public:
     /// @param[in] dataPtr Information about outging data
     void sendData(ToolsDataInfoPtr dataPtr);
 
+    /// @brief Request socket to send multiple data chunks at once
+    /// @details Invokes the sendDataListImpl(), which can be overridden
+    ///     by the derived class to coalesce the writes.
+    /// @param[in] dataList List of outgoing data chunks
+    void sendData(const QList<ToolsDataInfoPtr>& dataList);
+
     /// @brief Get properties describing socket connection right after plugins
     ///     have been loaded and applied.
     /// @details The returned value is used by the driving application to
@@ -104,6 +112,11 @@ public:
     /// @return OR-ed values of @ref ConnectionProperty values.
     unsigned connectionProperties() const;
 
+    /// @brief Get number of bytes accepted for sending, but not written to
+    ///     the I/O link yet.
+    /// @details Invokes the polymorphic sendBacklogImpl().
+    unsigned long long sendBacklog() const;
+
     /// @brief Apply inter-plugin configuration.
     /// @details Allows one plugin to influence the configuration of another.
     ///     This function will be called for all currently chosen plugins to override
@@ -160,12 +173,24 @@ protected:
     ///     the derived class.
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) = 0;
 
+    /// @brief Polymorphic multiple data chunks send functionality implementation.
+    /// @details Invoked by sendData(const QList<ToolsDataInfoPtr>&). The default
+    ///     implementation invokes sendDataImpl() for every data chunk. It
+    ///     can be overridden by the derived class.
+    virtual void sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList);
+
     /// @brief Polymorphic connection properties functionality implementation.
     /// @details Invoked by connectionProperties(). In can be overriden by the
     ///     derived class.
     /// @return 0.
     virtual unsigned connectionPropertiesImpl() const;
 
+    /// @brief Polymorphic send backlog retrieval functionality implementation.
+    /// @details Invoked by sendBacklog(). In can be overriden by the
+    ///     derived class.
+    /// @return 0.
+    virtual unsigned long long sendBacklogImpl() const;
+
     /// @brief Polymorphic inter-plugin configuration application.
     /// @details Invoked by the applyInterPluginConfig().
     /// @param[in] props Properties map.
@@ -174,6 +199,11 @@ protected:
     /// @brief Get current timestamp
     static unsigned long long currTimestamp();
 
+    /// @brief Coalesce multiple data chunks into a single buffer.
+    /// @details Can be used by the sendDataListImpl() overrides to perform
+    ///     a single write of all the chunks.
+    static QByteArray coalesceData(const QList<ToolsDataInfoPtr>& dataList);
+
     /// @brief Get current debug output level
     unsigned getDebugOutputLevel() const;    
 
@@ -23,6 +23,7 @@
 
 #include "comms/field/ArrayList.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 #include <memory>
@@ -205,9 +206,19 @@ private:
 
     void addFieldInternal(HasFeatureTag)
     {
-        auto& col = Base::field().value();
-        col.push_back(ElementType());
-        refreshMembersInternal(HasFeatureTag());
+        auto& storage = Base::field().value();
+        auto* prevData = storageData(storage);
+        storage.push_back(ElementType());
+
+        auto& mems = Base::getMembers();
+        if ((storageData(storage) != prevData) || ((mems.size() + 1U) != storage.size())) {
+            // The storage was reallocated, the existing members reference invalid elements
+            refreshMembersInternal(HasFeatureTag());
+            return;
+        }
+
+        mems.push_back(wrapElement(storage.back()));
+        updateMemberProps(*mems.back());
     }   
 
     void addFieldInternal(NoFeatureTag)
@@ -224,7 +235,20 @@ private:
         }
 
         storage.erase(storage.begin() + idx);
-        refreshMembersInternal(HasFeatureTag());
+
+        auto& mems = Base::getMembers();
+        if (mems.size() != (storage.size() + 1U)) {
+            refreshMembersInternal(HasFeatureTag());
+            return;
+        }
+
+        // The members wrap the elements by reference, the ones preceding
+        // the removed element remain valid, the following ones are shifted.
+        mems.pop_back();
+        for (auto memIdx = static_cast<std::size_t>(idx); memIdx < storage.size(); ++memIdx) {
+            mems[memIdx] = wrapElement(storage[memIdx]);
+            updateMemberProps(*mems[memIdx]);
+        }
     }
 
     void removeFieldInternal([[maybe_unused]] int idx, NoFeatureTag)
@@ -244,11 +268,7 @@ private:
         Members mems;
         mems.reserve(storage.size());
         for (auto& f : storage) {
-            mems.push_back(m_wrapFieldFunc(f));
-            if (!mems.back()->canWrite()) {
-                mems.back()->reset();
-                assert(mems.back()->canWrite());
-            }
+            mems.push_back(wrapElement(f));
         }
 
         Base::setMembers(std::move(mems));
@@ -258,6 +278,39 @@ private:
     {
     }    
 
+    ToolsFieldPtr wrapElement(ElementType& elem)
+    {
+        auto mem = m_wrapFieldFunc(elem);
+        assert(mem);
+        if (!mem->canWrite()) {
+            mem->reset();
+            assert(mem->canWrite());
+        }
+        return mem;
+    }
+
+    // Same update of a single member as performed by setMembers()
+    void updateMemberProps(ToolsField& mem)
+    {
+        if (mem.isReadOnly()) {
+            mem.forceReadOnly();
+        }
+
+        if (mem.isHiddenSerialization() || (!isHiddenSerializationImpl())) {
+            mem.forceHiddenSerialization();
+        }
+    }
+
+    template <typename TStorage>
+    static const ElementType* storageData(const TStorage& storage)
+    {
+        if (storage.empty()) {
+            return nullptr;
+        }
+
+        return &storage.front();
+    }
+
     WrapFieldCallbackFunc m_wrapFieldFunc;
 };
 
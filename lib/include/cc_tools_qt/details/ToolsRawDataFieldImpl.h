@@ -23,10 +23,14 @@
 
 #include "comms/field/ArrayList.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cassert>
+#include <iterator>
 #include <memory>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace cc_tools_qt
 {
@@ -39,9 +43,11 @@ class ToolsRawDataFieldImpl : public ToolsFieldBase<cc_tools_qt::field::ToolsRaw
 {
     using Base = ToolsFieldBase<cc_tools_qt::field::ToolsRawDataField, TField>;
     using Field = TField;
+    using ValueType = typename Field::ValueType;
 
 public:
     using SerialisedSeq = typename Base::SerialisedSeq;
+    using DataSeq = typename Base::DataSeq;
     using Ptr = typename Base::Ptr;
     using ActPtr = typename Base::ActPtr;
 
@@ -145,12 +151,55 @@ protected:
         return minSizeInternal(SizeExistanceTag());
     }
 
+    virtual int dataSizeImpl() const override
+    {
+        return static_cast<int>(Base::field().value().size());
+    }
+
+    virtual DataSeq getDataImpl(int from, int count) const override
+    {
+        auto& data = Base::field().value();
+        assert((0 <= from) && (0 <= count));
+        assert(static_cast<std::size_t>(from + count) <= data.size());
+        DataSeq result;
+        result.reserve(static_cast<std::size_t>(count));
+        auto begIter = std::next(data.begin(), from);
+        std::transform(
+            begIter, std::next(begIter, count), std::back_inserter(result),
+            [](auto byte)
+            {
+                return static_cast<typename DataSeq::value_type>(byte);
+            });
+        return result;
+    }
+
+    virtual bool setDataImpl(int from, const DataSeq& data) override
+    {
+        return setDataInternal(from, data, StorageTag());
+    }
+
+    virtual bool resizeDataImpl(int size) override
+    {
+        return resizeDataInternal(size, StorageTag());
+    }
+
     virtual Ptr cloneImpl() override
     {
         return ActPtr(new ToolsRawDataFieldImpl<TField>(Base::field()));
     }
 
 private:
+    struct ModifiableStorageTag {};
+    struct ViewStorageTag {};
+
+    // Views of the original input buffer cannot be updated in place
+    using StorageTag =
+        std::conditional_t<
+            std::is_const_v<std::remove_reference_t<decltype(std::declval<ValueType&>()[0])>>,
+            ViewStorageTag,
+            ModifiableStorageTag
+        >;
+
     struct SizeFieldExistsTag {};
     struct SerLengthFieldExistsTag {};
     struct FixedSizeTag {};
@@ -229,6 +278,38 @@ private:
     {
         return 0;
     }
+
+    bool setDataInternal(int from, const DataSeq& data, ModifiableStorageTag)
+    {
+        auto& storage = Base::field().value();
+        std::transform(
+            data.begin(), data.end(), std::next(storage.begin(), from),
+            [](auto byte)
+            {
+                return static_cast<typename ValueType::value_type>(byte);
+            });
+        return true;
+    }
+
+    bool setDataInternal(int from, const DataSeq& data, ViewStorageTag)
+    {
+        auto allData = getDataImpl(0, dataSizeImpl());
+        std::copy(data.begin(), data.end(), std::next(allData.begin(), from));
+        return Base::setSerialisedValueImpl(allData);
+    }
+
+    bool resizeDataInternal(int size, ModifiableStorageTag)
+    {
+        Base::field().value().resize(static_cast<std::size_t>(size));
+        return true;
+    }
+
+    bool resizeDataInternal(int size, ViewStorageTag)
+    {
+        auto allData = getDataImpl(0, dataSizeImpl());
+        allData.resize(static_cast<std::size_t>(size));
+        return Base::setSerialisedValueImpl(allData);
+    }
 };
 
 template <typename TField>
@@ -22,7 +22,9 @@
 
 #include <QtCore/QString>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace cc_tools_qt
 {
@@ -34,6 +36,7 @@ class CC_TOOLS_API ToolsRawDataField : public ToolsField
 {
 public:
     using ActPtr = std::unique_ptr<ToolsRawDataField>;
+    using DataSeq = std::vector<std::uint8_t>;
 
     ToolsRawDataField();
     virtual ~ToolsRawDataField() noexcept;
@@ -46,6 +49,11 @@ public:
 
     int minSize() const;
 
+    int dataSize() const;
+    DataSeq getData(int from, int count) const;
+    bool setData(int from, const DataSeq& data);
+    bool resizeData(int size);
+
     bool getForcedShowAll() const;
     void setForcedShowAll(bool val = true);
     bool isTruncated() const;
@@ -57,6 +65,10 @@ protected:
     virtual void setValueImpl(const QString& val) = 0;
     virtual int maxSizeImpl() const = 0;
     virtual int minSizeImpl() const = 0;
+    virtual int dataSizeImpl() const = 0;
+    virtual DataSeq getDataImpl(int from, int count) const = 0;
+    virtual bool setDataImpl(int from, const DataSeq& data) = 0;
+    virtual bool resizeDataImpl(int size) = 0;
 
     void dispatchImpl(ToolsFieldHandler& handler);
 
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "cc_tools_qt/ToolsApi.h"
+#include "cc_tools_qt/ToolsDataInfo.h"
 #include "cc_tools_qt/ToolsMessage.h"
 
 #include <QtCore/QObject>
@@ -150,6 +151,13 @@ public:
     ToolsMsgRawDataMsg();
 };
 
+class CC_TOOLS_API ToolsMsgFrameSize : public ToolsMsgPropBase<unsigned>
+{
+    using Base = ToolsMsgPropBase<unsigned>;
+public:
+    ToolsMsgFrameSize();
+};
+
 class CC_TOOLS_API ToolsMsgExtraInfoMsg : public ToolsMsgPropBase<ToolsMessagePtr>
 {
     using Base = ToolsMsgPropBase<ToolsMessagePtr>;
@@ -171,6 +179,13 @@ public:
     ToolsMsgForceExtraInfoExistence();
 };
 
+class CC_TOOLS_API ToolsMsgEncodedData : public ToolsMsgPropBase<ToolsDataInfoPtr>
+{
+    using Base = ToolsMsgPropBase<ToolsDataInfoPtr>;
+public:
+    ToolsMsgEncodedData();
+};
+
 class CC_TOOLS_API ToolsMsgDelay : public ToolsMsgPropBase<unsigned long long>
 {
     using Base = ToolsMsgPropBase<unsigned long long>;
@@ -44,6 +44,18 @@ ToolsDataInfo::ToolsDataInfo()
     registerMetaTypesIfNeeded();
 }    
 
+void ToolsDataInfo::mergeExtraProperties(const PropertiesMap& props)
+{
+    if (m_extraProperties.isEmpty()) {
+        m_extraProperties = props;
+        return;
+    }
+
+    for (auto iter = props.begin(); iter != props.end(); ++iter) {
+        m_extraProperties.insert(iter.key(), iter.value());
+    }
+}
+
 CC_TOOLS_API ToolsDataInfoPtr makeDataInfo()
 {
     return ToolsDataInfoPtr(new ToolsDataInfo());
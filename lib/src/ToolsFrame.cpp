@@ -32,6 +32,11 @@ ToolsMessagesList ToolsFrame::readData(const ToolsDataInfo& dataInfo, bool final
     return readDataImpl(dataInfo, final);
 }
 
+ToolsMessagePtr ToolsFrame::readSingleMessage(const ToolsDataInfo& dataInfo)
+{
+    return readSingleMessageImpl(dataInfo);
+}
+
 void ToolsFrame::updateMessage(ToolsMessage& msg)
 {
     updateMessageImpl(msg);
@@ -67,5 +72,10 @@ ToolsFrame::DataSeq ToolsFrame::writeProtMsg(const void* protInterface)
     return writeProtMsgImpl(protInterface);
 }
 
+ToolsMessagePtr ToolsFrame::readSingleMessageImpl([[maybe_unused]] const ToolsDataInfo& dataInfo)
+{
+    return ToolsMessagePtr();
+}
+
 }  // namespace cc_tools_qt
 
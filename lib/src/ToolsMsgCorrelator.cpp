@@ -0,0 +1,575 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cc_tools_qt/ToolsMsgCorrelator.h"
+
+#include "cc_tools_qt/field/ToolsOptionalField.h"
+#include "cc_tools_qt/property/message.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QStringList>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <utility>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+using TimestampType = ToolsMsgCorrelator::TimestampType;
+using Key = ToolsField::SerialisedSeq;
+
+// The latencies below LinearBucketsCount have their own buckets, the
+// higher ones are split into SubBucketsCount buckets per power of 2,
+// i.e. the precision is kept within ~3%.
+const unsigned SubBucketsBits = 5U;
+const TimestampType SubBucketsCount = 1U << SubBucketsBits;
+const TimestampType LinearBucketsCount = SubBucketsCount * 2U;
+
+struct PathElem
+{
+    QByteArray m_name;
+    int m_index = -1;
+};
+
+using Path = std::vector<PathElem>;
+
+struct RuleState
+{
+    Path m_reqPath;
+    Path m_rspPath;
+    std::map<Key, std::deque<TimestampType>> m_pending;
+    std::deque<std::pair<TimestampType, Key>> m_expiry;
+    std::vector<unsigned long long> m_histogram;
+    ToolsMsgCorrelator::Stats m_stats;
+};
+
+unsigned highestBit(TimestampType value)
+{
+    unsigned result = 0U;
+    while (1U < value) {
+        value >>= 1U;
+        ++result;
+    }
+
+    return result;
+}
+
+std::size_t bucketIdx(TimestampType latency)
+{
+    if (latency < LinearBucketsCount) {
+        return static_cast<std::size_t>(latency);
+    }
+
+    auto shift = highestBit(latency) - SubBucketsBits;
+    auto sub = latency >> shift;
+    assert((SubBucketsCount <= sub) && (sub < LinearBucketsCount));
+    return
+        static_cast<std::size_t>(
+            LinearBucketsCount + ((shift - 1U) * SubBucketsCount) + (sub - SubBucketsCount));
+}
+
+ToolsMsgCorrelator::HistogramBucket bucketInfo(std::size_t idx)
+{
+    ToolsMsgCorrelator::HistogramBucket result;
+    if (idx < LinearBucketsCount) {
+        result.m_from = idx;
+        result.m_to = idx;
+        return result;
+    }
+
+    auto offset = static_cast<TimestampType>(idx) - LinearBucketsCount;
+    auto shift = static_cast<unsigned>(offset / SubBucketsCount) + 1U;
+    auto sub = (offset % SubBucketsCount) + SubBucketsCount;
+    result.m_from = sub << shift;
+    result.m_to = ((sub + 1U) << shift) - 1U;
+    return result;
+}
+
+QByteArray normalisedName(const QString& name)
+{
+    auto str = name;
+    str.remove(QChar(' '));
+    return str.toUtf8();
+}
+
+bool namesMatch(const char* name, const QByteArray& expected)
+{
+    if (name == nullptr) {
+        return false;
+    }
+
+    auto* expIter = expected.constData();
+    auto* expEnd = expIter + expected.size();
+    for (; *name != '\0'; ++name) {
+        if (*name == ' ') {
+            continue;
+        }
+
+        if ((expIter == expEnd) || (*expIter != *name)) {
+            return false;
+        }
+
+        ++expIter;
+    }
+
+    return expIter == expEnd;
+}
+
+// Invalid path results in no elements and the rule doesn't match any message
+Path parsePath(const QString& str, bool& ok)
+{
+    Path result;
+    ok = true;
+    if (str.trimmed().isEmpty()) {
+        return result;
+    }
+
+    auto parts = str.split(QChar('.'));
+    for (auto& p : parts) {
+        auto part = p.trimmed();
+        auto bracketPos = part.indexOf(QChar('['));
+        PathElem nameElem;
+        nameElem.m_name = normalisedName(part.left(bracketPos));
+        if (nameElem.m_name.isEmpty()) {
+            ok = false;
+            return Path();
+        }
+
+        result.push_back(std::move(nameElem));
+        while (0 <= bracketPos) {
+            auto closePos = part.indexOf(QChar(']'), bracketPos);
+            if (closePos < 0) {
+                ok = false;
+                return Path();
+            }
+
+            bool idxOk = false;
+            PathElem idxElem;
+            idxElem.m_index = part.mid(bracketPos + 1, closePos - bracketPos - 1).trimmed().toInt(&idxOk, 0);
+            if ((!idxOk) || (idxElem.m_index < 0)) {
+                ok = false;
+                return Path();
+            }
+
+            result.push_back(std::move(idxElem));
+            bracketPos = part.indexOf(QChar('['), closePos);
+            if ((bracketPos < 0) && (closePos != (part.size() - 1))) {
+                ok = false;
+                return Path();
+            }
+        }
+    }
+
+    return result;
+}
+
+ToolsField* unwrapOptional(ToolsField* field)
+{
+    while (field != nullptr) {
+        auto* optField = dynamic_cast<field::ToolsOptionalField*>(field);
+        if (optField == nullptr) {
+            break;
+        }
+
+        if ((optField->getMode() != field::ToolsOptionalField::Mode::Exists) || (!optField->hasField())) {
+            return nullptr;
+        }
+
+        field = &optField->getField();
+    }
+
+    return field;
+}
+
+ToolsField* findField(ToolsMessage::FieldsList& fields, const Path& path)
+{
+    ToolsField* field = nullptr;
+    auto* members = &fields;
+    for (auto& elem : path) {
+        if (field != nullptr) {
+            field = unwrapOptional(field);
+            if (field == nullptr) {
+                return nullptr;
+            }
+
+            members = &field->getMembers();
+        }
+
+        if (0 <= elem.m_index) {
+            if (members->size() <= static_cast<std::size_t>(elem.m_index)) {
+                return nullptr;
+            }
+
+            field = (*members)[static_cast<std::size_t>(elem.m_index)].get();
+            continue;
+        }
+
+        auto iter =
+            std::find_if(
+                members->begin(), members->end(),
+                [&elem](auto& m)
+                {
+                    return namesMatch(m->name(), elem.m_name);
+                });
+
+        if (iter == members->end()) {
+            return nullptr;
+        }
+
+        field = iter->get();
+    }
+
+    return unwrapOptional(field);
+}
+
+bool retrieveKey(ToolsMessage& msg, const Path& path, Key& key)
+{
+    if (path.empty()) {
+        key.clear();
+        return true;
+    }
+
+    auto fields = msg.payloadFields();
+    auto* field = findField(fields, path);
+    if (field == nullptr) {
+        fields = msg.transportFields();
+        field = findField(fields, path);
+    }
+
+    if (field == nullptr) {
+        return false;
+    }
+
+    key = field->getSerialisedValue();
+    return true;
+}
+
+}  // namespace
+
+struct ToolsMsgCorrelator::InnerState
+{
+    using RuleIndices = std::vector<std::size_t>;
+    using IdMap = std::map<qlonglong, RuleIndices>;
+
+    RulesList m_rules;
+    std::vector<RuleState> m_rulesState;
+    IdMap m_reqMap;
+    IdMap m_rspMap;
+    TimestampType m_timeout = 0U;
+    TimestampType m_lastTimestamp = 0U;
+    unsigned long long m_updatesCount = 0U;
+
+    void resetStats();
+    void addRequest(RuleState& state, ToolsMessage& msg, TimestampType timestamp);
+    void addResponse(RuleState& state, ToolsMessage& msg, TimestampType timestamp);
+    void expire(RuleState& state, TimestampType now);
+};
+
+void ToolsMsgCorrelator::InnerState::resetStats()
+{
+    for (auto& state : m_rulesState) {
+        state.m_pending.clear();
+        state.m_expiry.clear();
+        state.m_histogram.clear();
+        state.m_stats = Stats();
+    }
+
+    m_lastTimestamp = 0U;
+    ++m_updatesCount;
+}
+
+void ToolsMsgCorrelator::InnerState::addRequest(RuleState& state, ToolsMessage& msg, TimestampType timestamp)
+{
+    Key key;
+    if (!retrieveKey(msg, state.m_reqPath, key)) {
+        return;
+    }
+
+    ++state.m_stats.m_requests;
+    ++state.m_stats.m_pending;
+    if (m_timeout != 0U) {
+        state.m_expiry.emplace_back(timestamp, key);
+    }
+
+    state.m_pending[std::move(key)].push_back(timestamp);
+}
+
+void ToolsMsgCorrelator::InnerState::addResponse(RuleState& state, ToolsMessage& msg, TimestampType timestamp)
+{
+    Key key;
+    auto iter = state.m_pending.end();
+    if (retrieveKey(msg, state.m_rspPath, key)) {
+        iter = state.m_pending.find(key);
+    }
+
+    // Late responses are reported as unmatched, their requests have timed out
+    if (iter == state.m_pending.end()) {
+        ++state.m_stats.m_unmatched;
+        return;
+    }
+
+    auto& timestamps = iter->second;
+    assert(!timestamps.empty());
+    auto reqTimestamp = timestamps.front();
+    timestamps.pop_front();
+    if (timestamps.empty()) {
+        state.m_pending.erase(iter);
+    }
+
+    assert(0U < state.m_stats.m_pending);
+    --state.m_stats.m_pending;
+    ++state.m_stats.m_matched;
+
+    TimestampType latency = 0U;
+    if (reqTimestamp < timestamp) {
+        latency = timestamp - reqTimestamp;
+    }
+
+    state.m_stats.m_maxLatency = std::max(state.m_stats.m_maxLatency, latency);
+    auto idx = bucketIdx(latency);
+    if (state.m_histogram.size() <= idx) {
+        state.m_histogram.resize(idx + 1U);
+    }
+
+    ++state.m_histogram[idx];
+}
+
+void ToolsMsgCorrelator::InnerState::expire(RuleState& state, TimestampType now)
+{
+    while (!state.m_expiry.empty()) {
+        auto& front = state.m_expiry.front();
+        if (now <= (front.first + m_timeout)) {
+            break;
+        }
+
+        // The pending requests of the same key are in the order of sending,
+        // the already responded ones have been removed.
+        auto iter = state.m_pending.find(front.second);
+        if (iter != state.m_pending.end()) {
+            auto& timestamps = iter->second;
+            while ((!timestamps.empty()) && (timestamps.front() <= front.first)) {
+                timestamps.pop_front();
+                assert(0U < state.m_stats.m_pending);
+                --state.m_stats.m_pending;
+                ++state.m_stats.m_timeouts;
+            }
+
+            if (timestamps.empty()) {
+                state.m_pending.erase(iter);
+            }
+        }
+
+        state.m_expiry.pop_front();
+    }
+}
+
+ToolsMsgCorrelator::ToolsMsgCorrelator() :
+    m_state(std::make_unique<InnerState>())
+{
+}
+
+ToolsMsgCorrelator::~ToolsMsgCorrelator() noexcept = default;
+
+void ToolsMsgCorrelator::setRules(RulesList&& rules)
+{
+    auto& s = *m_state;
+    s.m_rules = std::move(rules);
+    s.m_rulesState.clear();
+    s.m_rulesState.resize(s.m_rules.size());
+    s.m_reqMap.clear();
+    s.m_rspMap.clear();
+
+    for (auto idx = 0U; idx < s.m_rules.size(); ++idx) {
+        auto& rule = s.m_rules[idx];
+        auto& state = s.m_rulesState[idx];
+        bool reqOk = false;
+        bool rspOk = false;
+        state.m_reqPath = parsePath(rule.m_reqKeyPath, reqOk);
+        if (rule.m_rspKeyPath.trimmed().isEmpty()) {
+            state.m_rspPath = state.m_reqPath;
+            rspOk = reqOk;
+        }
+        else {
+            state.m_rspPath = parsePath(rule.m_rspKeyPath, rspOk);
+        }
+
+        // The key must be present in both or none of the messages
+        if ((!reqOk) || (!rspOk) || (state.m_reqPath.empty() != state.m_rspPath.empty())) {
+            continue;
+        }
+
+        s.m_reqMap[rule.m_reqId].push_back(idx);
+        s.m_rspMap[rule.m_rspId].push_back(idx);
+    }
+
+    s.resetStats();
+}
+
+const ToolsMsgCorrelator::RulesList& ToolsMsgCorrelator::rules() const
+{
+    return m_state->m_rules;
+}
+
+void ToolsMsgCorrelator::setTimeout(TimestampType timeoutMs)
+{
+    m_state->m_timeout = timeoutMs;
+    m_state->resetStats();
+}
+
+ToolsMsgCorrelator::TimestampType ToolsMsgCorrelator::timeout() const
+{
+    return m_state->m_timeout;
+}
+
+void ToolsMsgCorrelator::addMsg(ToolsMessage& msg)
+{
+    auto& s = *m_state;
+    if (s.m_reqMap.empty() || msg.idAsString().isEmpty()) {
+        return;
+    }
+
+    auto type = property::message::ToolsMsgType().getFrom(msg);
+    auto* idMap = &s.m_reqMap;
+    if (type == ToolsMessage::Type::Received) {
+        idMap = &s.m_rspMap;
+    }
+    else if (type != ToolsMessage::Type::Sent) {
+        return;
+    }
+
+    auto timestamp = property::message::ToolsMsgTimestamp().getFrom(msg);
+    s.m_lastTimestamp = std::max(s.m_lastTimestamp, timestamp);
+    expire(timestamp);
+
+    auto iter = idMap->find(msg.numericId());
+    if (iter == idMap->end()) {
+        return;
+    }
+
+    for (auto idx : iter->second) {
+        assert(idx < s.m_rulesState.size());
+        auto& state = s.m_rulesState[idx];
+        if (type == ToolsMessage::Type::Sent) {
+            s.addRequest(state, msg, timestamp);
+        }
+        else {
+            s.addResponse(state, msg, timestamp);
+        }
+    }
+
+    ++s.m_updatesCount;
+}
+
+void ToolsMsgCorrelator::process(const ToolsMessagesList& msgs)
+{
+    clear();
+    for (auto& msgPtr : msgs) {
+        assert(msgPtr);
+        addMsg(*msgPtr);
+    }
+
+    expireAccounted();
+}
+
+void ToolsMsgCorrelator::expire(TimestampType now)
+{
+    auto& s = *m_state;
+    if (s.m_timeout == 0U) {
+        return;
+    }
+
+    for (auto& state : s.m_rulesState) {
+        auto timeouts = state.m_stats.m_timeouts;
+        s.expire(state, now);
+        if (timeouts != state.m_stats.m_timeouts) {
+            ++s.m_updatesCount;
+        }
+    }
+}
+
+void ToolsMsgCorrelator::expireAccounted()
+{
+    expire(m_state->m_lastTimestamp);
+}
+
+void ToolsMsgCorrelator::clear()
+{
+    m_state->resetStats();
+}
+
+const ToolsMsgCorrelator::Stats& ToolsMsgCorrelator::stats(std::size_t ruleIdx) const
+{
+    assert(ruleIdx < m_state->m_rulesState.size());
+    return m_state->m_rulesState[ruleIdx].m_stats;
+}
+
+ToolsMsgCorrelator::TimestampType ToolsMsgCorrelator::latencyPercentile(std::size_t ruleIdx, double percent) const
+{
+    assert(ruleIdx < m_state->m_rulesState.size());
+    auto& state = m_state->m_rulesState[ruleIdx];
+    if (state.m_stats.m_matched == 0U) {
+        return 0U;
+    }
+
+    auto fraction = std::min(std::max(percent, 0.0), 100.0) / 100.0;
+    auto target =
+        std::max(
+            static_cast<unsigned long long>(std::ceil(fraction * static_cast<double>(state.m_stats.m_matched))),
+            1ULL);
+
+    unsigned long long count = 0U;
+    for (auto idx = 0U; idx < state.m_histogram.size(); ++idx) {
+        count += state.m_histogram[idx];
+        if (target <= count) {
+            return std::min(bucketInfo(idx).m_to, state.m_stats.m_maxLatency);
+        }
+    }
+
+    return state.m_stats.m_maxLatency;
+}
+
+ToolsMsgCorrelator::Histogram ToolsMsgCorrelator::histogram(std::size_t ruleIdx) const
+{
+    assert(ruleIdx < m_state->m_rulesState.size());
+    auto& counts = m_state->m_rulesState[ruleIdx].m_histogram;
+    Histogram result;
+    for (auto idx = 0U; idx < counts.size(); ++idx) {
+        if (counts[idx] == 0U) {
+            continue;
+        }
+
+        auto bucket = bucketInfo(idx);
+        bucket.m_count = counts[idx];
+        result.push_back(bucket);
+    }
+
+    return result;
+}
+
+unsigned long long ToolsMsgCorrelator::updatesCount() const
+{
+    return m_state->m_updatesCount;
+}
+
+}  // namespace cc_tools_qt
@@ -24,10 +24,27 @@
 
 namespace cc_tools_qt
 {
+
+namespace
+{
+
+unsigned long long idOffset(qlonglong id, qlonglong minId)
+{
+    assert(minId <= id);
+    return static_cast<unsigned long long>(id) - static_cast<unsigned long long>(minId);
+}
+
+} // namespace
+
 ToolsMsgFactory::~ToolsMsgFactory() = default;
 
 ToolsMessagePtr ToolsMsgFactory::createMessage(const QString& idAsString, unsigned idx)
 {
+    auto parsedIter = m_parsedIds.constFind(idAsString);
+    if (parsedIter != m_parsedIds.constEnd()) {
+        return createMessage(parsedIter.value(), idx);
+    }
+
     bool ok = false;
     auto numId = idAsString.toLongLong(&ok, 10);
     do {
@@ -43,62 +60,113 @@ ToolsMessagePtr ToolsMsgFactory::createMessage(const QString& idAsString, unsign
         return ToolsMessagePtr();
     } while (false);
 
+    m_parsedIds.insert(idAsString, numId);
     return createMessage(numId, idx);
 }
 
 ToolsMessagePtr ToolsMsgFactory::createMessage(const qlonglong id, unsigned idx)
 {
     createDefaultMessagesIfNeeded();
-    auto lowerIter = 
-        std::lower_bound(
-            m_defaultMsgs.begin(), m_defaultMsgs.end(), id,
-            [](auto& msg, qlonglong idParam)
-            {
-                return msg->numericId() < idParam;
-            });
-
-    if ((lowerIter == m_defaultMsgs.end()) ||
-        ((*lowerIter)->numericId() != id)) {
-        return ToolsMessagePtr();
-    }
-
-    auto upperIter = 
-        std::upper_bound(
-            m_defaultMsgs.begin(), m_defaultMsgs.end(), id,
-            [](qlonglong idParam, auto& msg)
-            {
-                return idParam < msg->numericId();
-            });
-
-    auto distance = static_cast<unsigned>(std::distance(lowerIter, upperIter));
-    if (distance <= idx) {
+    auto range = findIdRange(id);
+    if (range.second <= idx) {
         return ToolsMessagePtr();
     }
 
-    auto iter = lowerIter + idx;
-    assert(iter != m_defaultMsgs.end());
-    return (*iter)->clone();
+    auto typeIdx = static_cast<std::size_t>(range.first) + idx;
+    assert(typeIdx < m_defaultMsgs.size());
+    return createPooledMessage(typeIdx);
 }
 
 ToolsMessagesList ToolsMsgFactory::createAllMessages()
 {
     createDefaultMessagesIfNeeded();
     ToolsMessagesList result;
-    for (auto& m : m_defaultMsgs) {
-        assert(m);
-        result.push_back(m->clone());
+    for (auto idx = 0U; idx < m_defaultMsgs.size(); ++idx) {
+        result.push_back(createPooledMessage(idx));
     }
     return result;
 }
 
 ToolsMsgFactory::ToolsMsgFactory() = default;
 
+ToolsMessage::Ptr ToolsMsgFactory::createMessageImpl(std::size_t typeIdx)
+{
+    assert(typeIdx < m_defaultMsgs.size());
+    auto& msg = m_defaultMsgs[typeIdx];
+    assert(msg);
+    return msg->clone();
+}
+
 void ToolsMsgFactory::createDefaultMessagesIfNeeded()
 {
-    if (m_defaultMsgs.empty()) {
-        m_defaultMsgs = createAllMessagesImpl();
+    if (!m_defaultMsgs.empty()) {
+        return;
+    }
+
+    m_defaultMsgs = createAllMessagesImpl();
+    m_pool = std::make_shared<ToolsMsgPool>(m_defaultMsgs.size());
+
+    // The numeric IDs are retrieved only once to avoid virtual function
+    // calls during the lookup.
+    m_ids.clear();
+    m_ids.reserve(m_defaultMsgs.size());
+    for (auto& m : m_defaultMsgs) {
+        assert(m);
+        m_ids.push_back(m->numericId());
+    }
+
+    assert(std::is_sorted(m_ids.begin(), m_ids.end()));
+    m_denseIdRanges.clear();
+    if (m_ids.empty()) {
+        return;
+    }
+
+    // Use direct indexing when the IDs are not too sparse
+    static const unsigned long long MinDenseSpan = 1024U;
+    static const unsigned long long DenseSpanFactor = 8U;
+    m_minId = m_ids.front();
+    auto maxOffset = idOffset(m_ids.back(), m_minId);
+    if (std::max(MinDenseSpan, m_ids.size() * DenseSpanFactor) <= maxOffset) {
+        return;
+    }
+
+    m_denseIdRanges.resize(static_cast<std::size_t>(maxOffset + 1U));
+    for (auto idx = 0U; idx < m_ids.size(); ++idx) {
+        auto& range = m_denseIdRanges[static_cast<std::size_t>(idOffset(m_ids[idx], m_minId))];
+        if (range.second == 0U) {
+            range.first = idx;
+        }
+        ++range.second;
     }
 }
 
-}  // namespace cc_tools_qt
+ToolsMessagePtr ToolsMsgFactory::createPooledMessage(std::size_t typeIdx)
+{
+    assert(m_pool);
+    auto msg = m_pool->take(typeIdx);
+    if (!msg) {
+        msg = createMessageImpl(typeIdx);
+    }
 
+    assert(msg);
+    return m_pool->wrap(typeIdx, std::move(msg));
+}
+
+ToolsMsgFactory::IdRange ToolsMsgFactory::findIdRange(qlonglong id) const
+{
+    if (!m_denseIdRanges.empty()) {
+        if ((id < m_minId) || (m_denseIdRanges.size() <= idOffset(id, m_minId))) {
+            return IdRange();
+        }
+
+        return m_denseIdRanges[static_cast<std::size_t>(idOffset(id, m_minId))];
+    }
+
+    auto iters = std::equal_range(m_ids.begin(), m_ids.end(), id);
+    return
+        IdRange(
+            static_cast<unsigned>(std::distance(m_ids.begin(), iters.first)),
+            static_cast<unsigned>(std::distance(iters.first, iters.second)));
+}
+
+}  // namespace cc_tools_qt
@@ -0,0 +1,870 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cc_tools_qt/ToolsMsgIndex.h"
+
+#include "cc_tools_qt/ToolsFieldHandler.h"
+#include "cc_tools_qt/property/message.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+using MsgNumberType = ToolsMsgIndex::MsgNumberType;
+using MsgNumbersList = ToolsMsgIndex::MsgNumbersList;
+
+const std::size_t MaxBatchSize = 256U;
+const std::size_t MaxListElements = 64U;
+const int MaxStringLength = 256;
+const int MaxTokenLength = 64;
+
+// Queued message and the values extracted from it by the indexing thread,
+// or the removal of the message number
+struct Entry
+{
+    MsgNumberType m_msgNum = 0U;
+    ToolsMessagePtr m_msg;
+    bool m_removal = false;
+    std::vector<QString> m_strings;
+    std::vector<QString> m_tokens;
+    std::vector<std::pair<QByteArray, long long> > m_ints;
+    std::vector<std::pair<QByteArray, double> > m_doubles;
+};
+
+// Values of a single field path, the appended values are sorted on demand
+template <typename T>
+struct Column
+{
+    using ValueType = std::pair<T, MsgNumberType>;
+
+    void sort()
+    {
+        if (m_values.size() <= m_sortedCount) {
+            return;
+        }
+
+        auto mid = m_values.begin() + static_cast<std::ptrdiff_t>(m_sortedCount);
+        std::sort(mid, m_values.end());
+        std::inplace_merge(m_values.begin(), mid, m_values.end());
+        m_sortedCount = m_values.size();
+    }
+
+    // Keeps the relative order, the sorted part remains sorted
+    void remove(const MsgNumbersList& sortedMsgNums)
+    {
+        std::size_t sortedCount = 0U;
+        std::size_t writeIdx = 0U;
+        for (std::size_t idx = 0U; idx < m_values.size(); ++idx) {
+            if (std::binary_search(sortedMsgNums.begin(), sortedMsgNums.end(), m_values[idx].second)) {
+                continue;
+            }
+
+            if (idx < m_sortedCount) {
+                ++sortedCount;
+            }
+
+            m_values[writeIdx] = m_values[idx];
+            ++writeIdx;
+        }
+
+        m_values.resize(writeIdx);
+        m_sortedCount = sortedCount;
+    }
+
+    std::vector<ValueType> m_values;
+    std::size_t m_sortedCount = 0U;
+};
+
+enum class Op
+{
+    Eq,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Range
+};
+
+struct Literal
+{
+    bool m_integral = false;
+    long long m_int = 0;
+    double m_double = 0.0;
+};
+
+QByteArray normalisedName(const QString& name)
+{
+    auto str = name.toLower();
+    str.remove(QChar(' '));
+    return str.toUtf8();
+}
+
+QByteArray normalisedName(const char* name)
+{
+    if (name == nullptr) {
+        return QByteArray();
+    }
+
+    return normalisedName(QString::fromUtf8(name));
+}
+
+bool isWordChar(QChar ch)
+{
+    return ch.isLetterOrNumber() || (ch == QChar('_'));
+}
+
+void addTokens(const QString& str, std::vector<QString>& tokens)
+{
+    auto len = std::min(static_cast<int>(str.size()), MaxStringLength);
+    int start = -1;
+    for (int idx = 0; idx <= len; ++idx) {
+        if ((idx < len) && isWordChar(str[idx])) {
+            if (start < 0) {
+                start = idx;
+            }
+            continue;
+        }
+
+        if (start < 0) {
+            continue;
+        }
+
+        tokens.push_back(str.mid(start, std::min(idx - start, MaxTokenLength)).toLower());
+        start = -1;
+    }
+}
+
+long long clampedValue(unsigned long long value)
+{
+    static const auto MaxValue = static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+    return static_cast<long long>(std::min(value, MaxValue));
+}
+
+bool parseLiteral(const QString& str, Literal& literal)
+{
+    bool ok = false;
+    auto intVal = str.toLongLong(&ok, 0);
+    if (ok) {
+        literal.m_integral = true;
+        literal.m_int = intVal;
+        literal.m_double = static_cast<double>(intVal);
+        return true;
+    }
+
+    auto uintVal = str.toULongLong(&ok, 0);
+    if (ok) {
+        literal.m_integral = true;
+        literal.m_int = clampedValue(uintVal);
+        literal.m_double = static_cast<double>(uintVal);
+        return true;
+    }
+
+    auto doubleVal = str.toDouble(&ok);
+    if (ok) {
+        literal.m_integral = false;
+        literal.m_double = doubleVal;
+        return true;
+    }
+
+    return false;
+}
+
+ToolsField* unwrapOptional(ToolsField* field)
+{
+    while (field != nullptr) {
+        auto* optField = dynamic_cast<field::ToolsOptionalField*>(field);
+        if (optField == nullptr) {
+            break;
+        }
+
+        if ((optField->getMode() != field::ToolsOptionalField::Mode::Exists) || (!optField->hasField())) {
+            return nullptr;
+        }
+
+        field = &optField->getField();
+    }
+
+    return field;
+}
+
+class ValuesCollector : public ToolsFieldHandler
+{
+public:
+    explicit ValuesCollector(Entry& entry) : m_entry(entry) {}
+
+    void collect(ToolsMessage& msg)
+    {
+        auto* name = msg.name();
+        if (name != nullptr) {
+            m_entry.m_strings.push_back(QString::fromUtf8(name));
+        }
+
+        m_path = normalisedName(name);
+        auto fields = msg.payloadFields();
+        for (auto& f : fields) {
+            collectMember(*f);
+        }
+    }
+
+    virtual void handle(field::ToolsArrayListField& field) override
+    {
+        // The elements are referenced by the path of the list itself
+        auto& members = field.getMembers();
+        auto count = std::min(members.size(), MaxListElements);
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto* elem = unwrapOptional(members[idx].get());
+            if (elem != nullptr) {
+                elem->dispatch(*this);
+            }
+        }
+    }
+
+    virtual void handle(field::ToolsBitfieldField& field) override
+    {
+        collectMembers(field);
+    }
+
+    virtual void handle(field::ToolsBitmaskField& field) override
+    {
+        addInt(clampedValue(field.getValue()));
+    }
+
+    virtual void handle(field::ToolsBundleField& field) override
+    {
+        collectMembers(field);
+    }
+
+    virtual void handle(field::ToolsEnumField& field) override
+    {
+        auto value = field.getValue();
+        addInt(value);
+
+        auto& values = field.values();
+        auto iter =
+            std::find_if(
+                values.begin(), values.end(),
+                [value](auto& info)
+                {
+                    return info.second == value;
+                });
+
+        if (iter != values.end()) {
+            m_entry.m_strings.push_back(iter->first);
+        }
+    }
+
+    virtual void handle(field::ToolsFloatField& field) override
+    {
+        m_entry.m_doubles.emplace_back(m_path, field.getValue());
+    }
+
+    virtual void handle(field::ToolsIntField& field) override
+    {
+        addInt(field.getValue());
+    }
+
+    virtual void handle(field::ToolsOptionalField& field) override
+    {
+        auto* actField = unwrapOptional(&field);
+        if (actField != nullptr) {
+            actField->dispatch(*this);
+        }
+    }
+
+    virtual void handle([[maybe_unused]] field::ToolsRawDataField& field) override
+    {
+    }
+
+    virtual void handle(field::ToolsStringField& field) override
+    {
+        m_entry.m_strings.push_back(field.getValue());
+    }
+
+    virtual void handle([[maybe_unused]] field::ToolsUnknownField& field) override
+    {
+    }
+
+    virtual void handle(field::ToolsUnsignedLongField& field) override
+    {
+        addInt(clampedValue(field.getValue()));
+    }
+
+    virtual void handle(field::ToolsVariantField& field) override
+    {
+        collectMembers(field);
+    }
+
+    virtual void handle([[maybe_unused]] ToolsField& field) override
+    {
+    }
+
+private:
+    void collectMembers(ToolsField& field)
+    {
+        for (auto& m : field.getMembers()) {
+            collectMember(*m);
+        }
+    }
+
+    void collectMember(ToolsField& field)
+    {
+        auto* actField = unwrapOptional(&field);
+        if (actField == nullptr) {
+            return;
+        }
+
+        auto prevSize = m_path.size();
+        m_path.append('.');
+        m_path.append(normalisedName(field.name()));
+        actField->dispatch(*this);
+        m_path.truncate(prevSize);
+    }
+
+    void addInt(long long value)
+    {
+        m_entry.m_ints.emplace_back(m_path, value);
+    }
+
+    Entry& m_entry;
+    QByteArray m_path;
+};
+
+template <typename T, typename TKey>
+void collectRange(const Column<T>& column, Op op, TKey key, TKey maxKey, MsgNumbersList& result)
+{
+    auto& values = column.m_values;
+    assert(column.m_sortedCount == values.size());
+
+    auto valueLess =
+        [](const auto& elem, TKey k)
+        {
+            return static_cast<TKey>(elem.first) < k;
+        };
+
+    auto keyLess =
+        [](TKey k, const auto& elem)
+        {
+            return k < static_cast<TKey>(elem.first);
+        };
+
+    auto from = values.begin();
+    auto to = values.end();
+    switch (op) {
+        case Op::Eq:
+            from = std::lower_bound(values.begin(), values.end(), key, valueLess);
+            to = std::upper_bound(from, values.end(), key, keyLess);
+            break;
+        case Op::Range:
+            from = std::lower_bound(values.begin(), values.end(), key, valueLess);
+            to = std::upper_bound(from, values.end(), maxKey, keyLess);
+            break;
+        case Op::Lt:
+            to = std::lower_bound(values.begin(), values.end(), key, valueLess);
+            break;
+        case Op::Le:
+            to = std::upper_bound(values.begin(), values.end(), key, keyLess);
+            break;
+        case Op::Gt:
+            from = std::upper_bound(values.begin(), values.end(), key, keyLess);
+            break;
+        case Op::Ge:
+            from = std::lower_bound(values.begin(), values.end(), key, valueLess);
+            break;
+        default:
+            [[maybe_unused]] static constexpr bool Unexpected_operation = false;
+            assert(Unexpected_operation);
+            return;
+    }
+
+    for (; from != to; ++from) {
+        result.push_back(from->second);
+    }
+}
+
+void sortUnique(MsgNumbersList& list)
+{
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+}
+
+Entry addedEntry(MsgNumberType msgNum, ToolsMessagePtr msg)
+{
+    assert(msg);
+    Entry entry;
+    entry.m_msgNum = msgNum;
+
+    // Unlike the fields, the comment can be modified after the addition
+    auto comment = property::message::ToolsMsgComment().getFrom(*msg);
+    if (!comment.isEmpty()) {
+        entry.m_strings.push_back(std::move(comment));
+    }
+
+    entry.m_msg = std::move(msg);
+    return entry;
+}
+
+Entry removalEntry(MsgNumberType msgNum)
+{
+    Entry entry;
+    entry.m_msgNum = msgNum;
+    entry.m_removal = true;
+    return entry;
+}
+
+} // namespace
+
+struct ToolsMsgIndex::InnerState
+{
+    using IntColumns = std::map<QByteArray, Column<long long> >;
+    using DoubleColumns = std::map<QByteArray, Column<double> >;
+    using Postings = std::map<QString, MsgNumbersList>;
+
+    void run();
+    void enqueue(std::vector<Entry>&& entries);
+    void insert(const Entry& entry);
+    void remove(MsgNumbersList& msgNums);
+    bool searchWord(const QString& word, MsgNumbersList& result) const;
+    bool searchNumeric(const QString& term, int opPos, MsgNumbersList& result, QString& error);
+
+    template <typename TColumns, typename TFunc>
+    void forEachColumn(TColumns& columns, const QByteArray& msgName, const QByteArray& fieldPath, TFunc&& func)
+    {
+        if (!msgName.isEmpty()) {
+            auto iter = columns.find(msgName + '.' + fieldPath);
+            if (iter != columns.end()) {
+                func(iter->second);
+            }
+            return;
+        }
+
+        for (auto& info : columns) {
+            auto sepPos = info.first.indexOf('.');
+            if ((0 <= sepPos) && (info.first.mid(sepPos + 1) == fieldPath)) {
+                func(info.second);
+            }
+        }
+    }
+
+    mutable QMutex m_queueMutex;
+    QWaitCondition m_queueCond;
+    std::deque<Entry> m_queue;
+    bool m_stopRequested = false;
+
+    // Held by the indexing thread while processing the messages
+    QMutex m_processMutex;
+
+    QMutex m_dataMutex;
+    Postings m_tokens;
+    IntColumns m_ints;
+    DoubleColumns m_doubles;
+
+    std::unique_ptr<QThread> m_thread;
+};
+
+void ToolsMsgIndex::InnerState::run()
+{
+    std::vector<Entry> batch;
+    while (true) {
+        m_queueMutex.lock();
+        while (m_queue.empty() && (!m_stopRequested)) {
+            m_queueCond.wait(&m_queueMutex);
+        }
+
+        if (m_stopRequested) {
+            m_queueMutex.unlock();
+            break;
+        }
+
+        auto count = std::min(m_queue.size(), MaxBatchSize);
+        auto batchEnd = m_queue.begin() + static_cast<std::ptrdiff_t>(count);
+        batch.assign(std::make_move_iterator(m_queue.begin()), std::make_move_iterator(batchEnd));
+        m_queue.erase(m_queue.begin(), batchEnd);
+        m_processMutex.lock();
+        m_queueMutex.unlock();
+
+        for (auto& entry : batch) {
+            if (entry.m_msg) {
+                ValuesCollector(entry).collect(*entry.m_msg);
+
+                // Release the message before clear() is allowed to return
+                entry.m_msg.reset();
+            }
+
+            for (auto& str : entry.m_strings) {
+                addTokens(str, entry.m_tokens);
+            }
+        }
+
+        {
+            QMutexLocker dataLock(&m_dataMutex);
+            MsgNumbersList removed;
+            for (auto& entry : batch) {
+                if (entry.m_removal) {
+                    removed.push_back(entry.m_msgNum);
+                    continue;
+                }
+
+                // The reindexed message must be removed first
+                if (!removed.empty()) {
+                    remove(removed);
+                }
+
+                insert(entry);
+            }
+
+            if (!removed.empty()) {
+                remove(removed);
+            }
+        }
+
+        batch.clear();
+        m_processMutex.unlock();
+    }
+}
+
+void ToolsMsgIndex::InnerState::enqueue(std::vector<Entry>&& entries)
+{
+    {
+        QMutexLocker lock(&m_queueMutex);
+        m_queue.insert(m_queue.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+    }
+
+    m_queueCond.wakeOne();
+}
+
+void ToolsMsgIndex::InnerState::insert(const Entry& entry)
+{
+    for (auto& token : entry.m_tokens) {
+        auto& postings = m_tokens[token];
+        if (postings.empty() || (postings.back() < entry.m_msgNum)) {
+            postings.push_back(entry.m_msgNum);
+            continue;
+        }
+
+        // Reindexed message
+        auto iter = std::lower_bound(postings.begin(), postings.end(), entry.m_msgNum);
+        if ((iter == postings.end()) || (*iter != entry.m_msgNum)) {
+            postings.insert(iter, entry.m_msgNum);
+        }
+    }
+
+    for (auto& info : entry.m_ints) {
+        m_ints[info.first].m_values.emplace_back(info.second, entry.m_msgNum);
+    }
+
+    for (auto& info : entry.m_doubles) {
+        m_doubles[info.first].m_values.emplace_back(info.second, entry.m_msgNum);
+    }
+}
+
+void ToolsMsgIndex::InnerState::remove(MsgNumbersList& msgNums)
+{
+    sortUnique(msgNums);
+    auto isRemoved =
+        [&msgNums](MsgNumberType msgNum)
+        {
+            return std::binary_search(msgNums.begin(), msgNums.end(), msgNum);
+        };
+
+    for (auto iter = m_tokens.begin(); iter != m_tokens.end();) {
+        auto& postings = iter->second;
+        postings.erase(std::remove_if(postings.begin(), postings.end(), isRemoved), postings.end());
+        if (postings.empty()) {
+            iter = m_tokens.erase(iter);
+            continue;
+        }
+
+        ++iter;
+    }
+
+    auto removeFromColumns =
+        [&msgNums](auto& columns)
+        {
+            for (auto iter = columns.begin(); iter != columns.end();) {
+                iter->second.remove(msgNums);
+                if (iter->second.m_values.empty()) {
+                    iter = columns.erase(iter);
+                    continue;
+                }
+
+                ++iter;
+            }
+        };
+
+    removeFromColumns(m_ints);
+    removeFromColumns(m_doubles);
+    msgNums.clear();
+}
+
+bool ToolsMsgIndex::InnerState::searchWord(const QString& word, MsgNumbersList& result) const
+{
+    bool prefix = word.endsWith(QChar('*'));
+    std::vector<QString> tokens;
+    addTokens(prefix ? word.left(word.size() - 1) : word, tokens);
+    if (tokens.empty()) {
+        return false;
+    }
+
+    // All the tokens of the word must be present
+    bool first = true;
+    for (std::size_t idx = 0U; idx < tokens.size(); ++idx) {
+        auto& token = tokens[idx];
+        MsgNumbersList tokenResult;
+        if (prefix && (idx == (tokens.size() - 1U))) {
+            for (auto iter = m_tokens.lower_bound(token); iter != m_tokens.end(); ++iter) {
+                if (!iter->first.startsWith(token)) {
+                    break;
+                }
+
+                tokenResult.insert(tokenResult.end(), iter->second.begin(), iter->second.end());
+            }
+
+            sortUnique(tokenResult);
+        }
+        else {
+            auto iter = m_tokens.find(token);
+            if (iter != m_tokens.end()) {
+                tokenResult = iter->second;
+            }
+        }
+
+        if (first) {
+            result = std::move(tokenResult);
+            first = false;
+            continue;
+        }
+
+        MsgNumbersList intersection;
+        std::set_intersection(
+            result.begin(), result.end(), tokenResult.begin(), tokenResult.end(),
+            std::back_inserter(intersection));
+        result = std::move(intersection);
+    }
+
+    return true;
+}
+
+bool ToolsMsgIndex::InnerState::searchNumeric(const QString& term, int opPos, MsgNumbersList& result, QString& error)
+{
+    auto path = term.left(opPos);
+    auto sepPos = path.indexOf(QChar('.'));
+    if ((sepPos <= 0) || (path.size() <= (sepPos + 1))) {
+        error = QObject::tr("Field path is expected in the \"MsgName.field\" form: %1").arg(term);
+        return false;
+    }
+
+    auto msgName = path.left(sepPos);
+    if (msgName == QStringLiteral("*")) {
+        msgName.clear();
+    }
+
+    auto fieldPath = normalisedName(path.mid(sepPos + 1));
+
+    auto valuePos = opPos + 1;
+    auto opChar = term[opPos];
+    bool withEq = (valuePos < term.size()) && (term[valuePos] == QChar('='));
+    if (withEq) {
+        ++valuePos;
+    }
+
+    auto op = Op::Eq;
+    if (opChar == QChar('<')) {
+        op = withEq ? Op::Le : Op::Lt;
+    }
+    else if (opChar == QChar('>')) {
+        op = withEq ? Op::Ge : Op::Gt;
+    }
+
+    auto valueStr = term.mid(valuePos);
+    auto maxValueStr = QString();
+    auto rangeSepPos = valueStr.indexOf(QStringLiteral(".."));
+    if ((op == Op::Eq) && (0 < rangeSepPos)) {
+        maxValueStr = valueStr.mid(rangeSepPos + 2);
+        valueStr = valueStr.left(rangeSepPos);
+        op = Op::Range;
+    }
+
+    Literal value;
+    Literal maxValue;
+    if ((!parseLiteral(valueStr, value)) ||
+        ((op == Op::Range) && (!parseLiteral(maxValueStr, maxValue)))) {
+        error = QObject::tr("Numeric value is expected: %1").arg(term);
+        return false;
+    }
+
+    auto intKeys = value.m_integral && ((op != Op::Range) || maxValue.m_integral);
+    auto normMsgName = normalisedName(msgName);
+    forEachColumn(
+        m_ints, normMsgName, fieldPath,
+        [&](Column<long long>& column)
+        {
+            column.sort();
+            if (intKeys) {
+                collectRange(column, op, value.m_int, maxValue.m_int, result);
+                return;
+            }
+
+            collectRange(column, op, value.m_double, maxValue.m_double, result);
+        });
+
+    forEachColumn(
+        m_doubles, normMsgName, fieldPath,
+        [&](Column<double>& column)
+        {
+            column.sort();
+            collectRange(column, op, value.m_double, maxValue.m_double, result);
+        });
+
+    sortUnique(result);
+    return true;
+}
+
+ToolsMsgIndex::ToolsMsgIndex() :
+    m_state(std::make_unique<InnerState>())
+{
+    auto* state = m_state.get();
+    m_state->m_thread.reset(
+        QThread::create(
+            [state]()
+            {
+                state->run();
+            }));
+    m_state->m_thread->start(QThread::LowPriority);
+}
+
+ToolsMsgIndex::~ToolsMsgIndex() noexcept
+{
+    {
+        QMutexLocker lock(&m_state->m_queueMutex);
+        m_state->m_stopRequested = true;
+        m_state->m_queue.clear();
+    }
+
+    m_state->m_queueCond.wakeAll();
+    m_state->m_thread->wait();
+}
+
+void ToolsMsgIndex::addMsg(MsgNumberType msgNum, ToolsMessagePtr msg)
+{
+    std::vector<Entry> entries;
+    entries.push_back(addedEntry(msgNum, std::move(msg)));
+    m_state->enqueue(std::move(entries));
+}
+
+void ToolsMsgIndex::updateMsg(MsgNumberType msgNum, ToolsMessagePtr msg)
+{
+    std::vector<Entry> entries;
+    entries.push_back(removalEntry(msgNum));
+    entries.push_back(addedEntry(msgNum, std::move(msg)));
+    m_state->enqueue(std::move(entries));
+}
+
+void ToolsMsgIndex::removeMsg(MsgNumberType msgNum)
+{
+    std::vector<Entry> entries;
+    entries.push_back(removalEntry(msgNum));
+    m_state->enqueue(std::move(entries));
+}
+
+void ToolsMsgIndex::clear()
+{
+    {
+        QMutexLocker lock(&m_state->m_queueMutex);
+        m_state->m_queue.clear();
+    }
+
+    QMutexLocker processLock(&m_state->m_processMutex);
+    QMutexLocker dataLock(&m_state->m_dataMutex);
+    m_state->m_tokens.clear();
+    m_state->m_ints.clear();
+    m_state->m_doubles.clear();
+}
+
+std::size_t ToolsMsgIndex::pendingCount() const
+{
+    QMutexLocker lock(&m_state->m_queueMutex);
+    return m_state->m_queue.size();
+}
+
+bool ToolsMsgIndex::search(const QString& query, MsgNumbersList& result, QString& error)
+{
+    result.clear();
+    error.clear();
+
+    auto terms = query.simplified().split(QChar(' '));
+    QMutexLocker dataLock(&m_state->m_dataMutex);
+    bool first = true;
+    for (const auto& term : terms) {
+        if (term.isEmpty()) {
+            continue;
+        }
+
+        auto opPos = -1;
+        for (auto idx = 0; idx < term.size(); ++idx) {
+            auto ch = term[idx];
+            if ((ch == QChar('=')) || (ch == QChar('<')) || (ch == QChar('>'))) {
+                opPos = idx;
+                break;
+            }
+        }
+
+        MsgNumbersList termResult;
+        if (opPos < 0) {
+            if (!m_state->searchWord(term, termResult)) {
+                continue;
+            }
+        }
+        else if (!m_state->searchNumeric(term, opPos, termResult, error)) {
+            result.clear();
+            return false;
+        }
+
+        if (first) {
+            result = std::move(termResult);
+            first = false;
+            continue;
+        }
+
+        MsgNumbersList intersection;
+        std::set_intersection(
+            result.begin(), result.end(), termResult.begin(), termResult.end(),
+            std::back_inserter(intersection));
+        result = std::move(intersection);
+    }
+
+    return true;
+}
+
+}  // namespace cc_tools_qt
@@ -90,6 +90,86 @@ void ToolsMsgMgr::addMsgs(const ToolsMessagesList& msgs, bool reportAdded)
     m_impl->addMsgs(msgs, reportAdded);
 }
 
+void ToolsMsgMgr::setCompactHistoryEnabled(bool enabled)
+{
+    m_impl->setCompactHistoryEnabled(enabled);
+}
+
+bool ToolsMsgMgr::isCompactHistoryEnabled() const
+{
+    return m_impl->isCompactHistoryEnabled();
+}
+
+std::size_t ToolsMsgMgr::getMsgsCount() const
+{
+    return m_impl->getMsgsCount();
+}
+
+ToolsMessagePtr ToolsMsgMgr::getMsg(std::size_t idx)
+{
+    return m_impl->getMsg(idx);
+}
+
+void ToolsMsgMgr::updateMsgComment(const ToolsMessage& msg)
+{
+    m_impl->updateMsgComment(msg);
+}
+
+void ToolsMsgMgr::setSearchIndexEnabled(bool enabled)
+{
+    m_impl->setSearchIndexEnabled(enabled);
+}
+
+bool ToolsMsgMgr::isSearchIndexEnabled() const
+{
+    return m_impl->isSearchIndexEnabled();
+}
+
+bool ToolsMsgMgr::searchMsgs(const QString& query, MsgNumbersList& result, QString& error)
+{
+    return m_impl->searchMsgs(query, result, error);
+}
+
+ToolsMessagesList ToolsMsgMgr::findMsgs(const MsgNumbersList& msgNums)
+{
+    return m_impl->findMsgs(msgNums);
+}
+
+ToolsMessagePtr ToolsMsgMgr::findMsg(MsgNumberType msgNum)
+{
+    return m_impl->findMsg(msgNum);
+}
+
+void ToolsMsgMgr::deleteMsgs(const MsgNumbersList& msgNums)
+{
+    m_impl->deleteMsgs(msgNums);
+}
+
+ToolsMsgMgr::MsgNumberType ToolsMsgMgr::getMsgNumber(const ToolsMessage& msg)
+{
+    return ToolsMsgMgrImpl::getMsgNumber(msg);
+}
+
+const ToolsMsgStats& ToolsMsgMgr::getStats() const
+{
+    return m_impl->getStats();
+}
+
+void ToolsMsgMgr::clearStats()
+{
+    m_impl->clearStats();
+}
+
+ToolsMsgCorrelator& ToolsMsgMgr::getCorrelator()
+{
+    return m_impl->getCorrelator();
+}
+
+void ToolsMsgMgr::correlateStoredMsgs()
+{
+    m_impl->correlateStoredMsgs();
+}
+
 void ToolsMsgMgr::setSocket(ToolsSocketPtr socket)
 {
     m_impl->setSocket(std::move(socket));
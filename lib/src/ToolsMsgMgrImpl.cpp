@@ -23,10 +23,10 @@
 #include <chrono>
 #include <iostream>
 #include <iterator>
+#include <utility>
 
 #include <QtCore/QVariant>
 
-#include "comms/util/ScopeGuard.h"
 #include "cc_tools_qt/property/message.h"
 
 namespace cc_tools_qt
@@ -42,6 +42,14 @@ public:
     SeqNumber() : Base("cc.msg_num") {};
 };
 
+enum CompactFlag : std::uint8_t
+{
+    CompactFlag_Valid = 0x1,
+    CompactFlag_Garbage = 0x2,
+};
+
+const std::size_t MinDecodedPruneLimit = 1024U;
+
 void updateMsgTimestamp(ToolsMessage& msg, const ToolsDataInfo::Timestamp& timestamp)
 {
     auto sinceEpoch = timestamp.time_since_epoch();
@@ -126,49 +134,86 @@ void ToolsMsgMgrImpl::setRecvEnabled(bool enabled)
 
 void ToolsMsgMgrImpl::deleteMsgs(const ToolsMessagesList& msgs)
 {
-    auto listIter = msgs.begin();
-    auto storedIter = m_allMsgs.begin();
-    auto prevStoredIter = storedIter;
-    while ((listIter != msgs.end()) && (storedIter != m_allMsgs.end())) {
-        auto listMsgNum = SeqNumber().getFrom(**listIter);
-        auto storedMsgNum = SeqNumber().getFrom(**storedIter);
+    MsgNumbersList msgNums;
+    msgNums.reserve(msgs.size());
+    for (auto& m : msgs) {
+        assert(m);
+        msgNums.push_back(SeqNumber().getFrom(*m));
+    }
+
+    deleteMsgs(msgNums);
+}
+
+void ToolsMsgMgrImpl::deleteMsgs(const SearchMsgNumbersList& msgNums)
+{
+    if (m_searchIndex) {
+        for (auto msgNum : msgNums) {
+            m_searchIndex->removeMsg(msgNum);
+        }
+    }
+
+    if (m_compactHistoryEnabled) {
+        compactDeleteMsgs(MsgNumbersList(msgNums));
+        return;
+    }
 
-        if (storedMsgNum == listMsgNum) {
-            ++listIter;
-            ++storedIter;
+    MsgNumbersList sortedNums(msgNums);
+    std::sort(sortedNums.begin(), sortedNums.end());
+
+    auto writeIter = m_allMsgsIndex.begin();
+    for (auto readIter = m_allMsgsIndex.begin(); readIter != m_allMsgsIndex.end(); ++readIter) {
+        if (std::binary_search(sortedNums.begin(), sortedNums.end(), readIter->first)) {
+            m_allMsgs.erase(readIter->second);
             continue;
         }
 
-        m_allMsgs.erase(prevStoredIter, storedIter);
-        ++storedIter;
-        prevStoredIter = storedIter;
+        *writeIter = *readIter;
+        ++writeIter;
     }
 
-    m_allMsgs.erase(prevStoredIter, storedIter);
+    m_allMsgsIndex.erase(writeIter, m_allMsgsIndex.end());
 }
 
 void ToolsMsgMgrImpl::deleteMsg(ToolsMessagePtr msg)
 {
-    assert(!m_allMsgs.empty());
     assert(msg);
-
     auto msgNum = SeqNumber().getFrom(*msg);
+    if (m_searchIndex) {
+        m_searchIndex->removeMsg(msgNum);
+    }
 
-    auto iter = std::find_if(
-        m_allMsgs.begin(),
-        m_allMsgs.end(),
-        [msgNum](const ToolsMessagePtr& msgTmp) -> bool
-        {
-            return SeqNumber().getFrom(*msgTmp) == msgNum;
-        });
+    if (m_compactHistoryEnabled) {
+        if (compactFindMsg(msgNum) == m_compact.m_msgNums.size()) {
+            [[maybe_unused]] static constexpr bool Deleting_non_existing_message = false;
+            assert(Deleting_non_existing_message);
+            return;
+        }
 
-    if (iter == m_allMsgs.end()) {
+        compactDeleteMsgs(MsgNumbersList{msgNum});
+        return;
+    }
+
+    assert(!m_allMsgs.empty());
+
+    auto iter = findStoredMsg(msgNum);
+    if (iter == m_allMsgsIndex.end()) {
         [[maybe_unused]] static constexpr bool Deleting_non_existing_message = false;
         assert(Deleting_non_existing_message);         
         return;
     }
 
-    m_allMsgs.erase(iter);
+    m_allMsgs.erase(iter->second);
+    m_allMsgsIndex.erase(iter);
+}
+
+void ToolsMsgMgrImpl::deleteAllMsgs()
+{
+    m_allMsgs.clear();
+    m_allMsgsIndex.clear();
+    compactClear();
+    if (m_searchIndex) {
+        m_searchIndex->clear();
+    }
 }
 
 void ToolsMsgMgrImpl::sendMsgs(ToolsMessagesList&& msgs)
@@ -177,23 +222,19 @@ void ToolsMsgMgrImpl::sendMsgs(ToolsMessagesList&& msgs)
         return;
     }
 
-    for (auto& msgPtr : msgs) {
-        if (!msgPtr) {
-            continue;
-        }
-
-        auto updateMsgGuard =
-            comms::util::makeScopeGuard(
-                [this, &msgPtr]()
-                {
-                    updateInternalId(*msgPtr);
-                    property::message::ToolsMsgType().setTo(MsgType::Sent, *msgPtr);
-                    auto now = ToolsDataInfo::TimestampClock::now();
-                    updateMsgTimestamp(*msgPtr, now);
-                    m_allMsgs.push_back(msgPtr);
-                    reportMsgAdded(msgPtr);
-                });
+    msgs.remove_if(
+        [](const ToolsMessagePtr& msgPtr)
+        {
+            return !msgPtr;
+        });
 
+    // All the messages are encoded first and handed to the socket as a
+    // single batch to allow it to coalesce the writes.
+    QList<ToolsDataInfoPtr> allData;
+    std::vector<int> dataCounts;
+    dataCounts.reserve(msgs.size());
+    for (auto& msgPtr : msgs) {
+        dataCounts.push_back(0);
         auto dataInfoPtr = m_protocol->write(*msgPtr);
         if (!dataInfoPtr) {
             continue;
@@ -215,24 +256,39 @@ void ToolsMsgMgrImpl::sendMsgs(ToolsMessagesList&& msgs)
             data.swap(dataTmp);
         }
 
-        if (data.isEmpty()) {
-            continue;
-        }
+        dataCounts.back() = static_cast<int>(data.size());
+        allData.append(std::move(data));
+    }
 
-        for (auto& d : data) {
-            m_socket->sendData(d);
-
-            if (!d->m_extraProperties.isEmpty()) {
-                auto map = property::message::ToolsMsgExtraInfo().getFrom(*msgPtr);
-                for (auto& key : d->m_extraProperties.keys()) {
-                    map.insert(key, d->m_extraProperties.value(key));
-                }
-                property::message::ToolsMsgExtraInfo().setTo(std::move(map), *msgPtr);
-                m_protocol->updateMessage(*msgPtr);
+    m_socket->sendData(allData);
+
+    auto dataIter = allData.cbegin();
+    auto countIter = dataCounts.cbegin();
+    for (auto& msgPtr : msgs) {
+        assert(countIter != dataCounts.cend());
+        auto dataCount = *countIter;
+        ++countIter;
+
+        std::size_t sentBytes = 0U;
+        if (0 < dataCount) {
+            for (auto idx = 0; idx < dataCount; ++idx, ++dataIter) {
+                assert(dataIter != allData.cend());
+                auto& d = *dataIter;
+                sentBytes += d->m_data.size();
+                m_protocol->mergeExtraInfo(d->m_extraProperties, *msgPtr);
             }
+
+            m_protocol->messageSentReport(msgPtr);
         }
 
-        m_protocol->messageSentReport(msgPtr);
+        updateInternalId(*msgPtr);
+        property::message::ToolsMsgType().setTo(MsgType::Sent, *msgPtr);
+        auto now = ToolsDataInfo::TimestampClock::now();
+        updateMsgTimestamp(*msgPtr, now);
+        m_stats.addMsg(*msgPtr, sentBytes);
+        m_correlator.addMsg(*msgPtr);
+        storeMsg(msgPtr);
+        reportMsgAdded(msgPtr);
     }
 }
 
@@ -260,8 +316,223 @@ void ToolsMsgMgrImpl::addMsgs(const ToolsMessagesList& msgs, bool reportAdded)
         if (reportAdded) {
             reportMsgAdded(m);
         }
-        m_allMsgs.push_back(m);
+        storeMsg(m);
+    }
+}
+
+void ToolsMsgMgrImpl::setCompactHistoryEnabled(bool enabled)
+{
+    if (m_compactHistoryEnabled == enabled) {
+        return;
+    }
+
+    if (enabled) {
+        m_compactHistoryEnabled = true;
+        for (auto& m : m_allMsgs) {
+            assert(m);
+            compactStoreMsg(m);
+        }
+
+        m_allMsgs.clear();
+        m_allMsgsIndex.clear();
+        return;
+    }
+
+    ToolsMessagesList msgs;
+    auto count = m_compact.m_msgNums.size();
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        auto msg = compactDecodeMsg(idx);
+        if (msg) {
+            msgs.push_back(std::move(msg));
+        }
+    }
+
+    compactClear();
+    assert(m_allMsgs.empty());
+    m_allMsgs.splice(m_allMsgs.begin(), std::move(msgs));
+    indexStoredMsgs(m_allMsgs.begin());
+    m_compactHistoryEnabled = false;
+}
+
+std::size_t ToolsMsgMgrImpl::getMsgsCount() const
+{
+    if (m_compactHistoryEnabled) {
+        return m_compact.m_msgNums.size();
+    }
+
+    return m_allMsgs.size();
+}
+
+ToolsMessagePtr ToolsMsgMgrImpl::getMsg(std::size_t idx)
+{
+    if (m_compactHistoryEnabled) {
+        if (m_compact.m_msgNums.size() <= idx) {
+            return ToolsMessagePtr();
+        }
+
+        return compactDecodeMsg(idx);
+    }
+
+    if (m_allMsgsIndex.size() <= idx) {
+        return ToolsMessagePtr();
+    }
+
+    return *m_allMsgsIndex[idx].second;
+}
+
+void ToolsMsgMgrImpl::updateMsgComment(const ToolsMessage& msg)
+{
+    auto msgNum = SeqNumber().getFrom(msg);
+    if (!m_compactHistoryEnabled) {
+        if (!m_searchIndex) {
+            return;
+        }
+
+        auto iter = findStoredMsg(msgNum);
+        if (iter != m_allMsgsIndex.end()) {
+            m_searchIndex->updateMsg(msgNum, *iter->second);
+        }
+        return;
+    }
+
+    auto idx = compactFindMsg(msgNum);
+    if (idx == m_compact.m_msgNums.size()) {
+        return;
+    }
+
+    auto comment = property::message::ToolsMsgComment().getFrom(msg);
+    if (comment.isEmpty()) {
+        m_compact.m_comments.remove(msgNum);
+    }
+    else {
+        m_compact.m_comments.insert(msgNum, comment);
+    }
+
+    if (!m_searchIndex) {
+        return;
+    }
+
+    auto decodedMsg = compactDecodeMsg(idx);
+    if (decodedMsg) {
+        m_searchIndex->updateMsg(msgNum, std::move(decodedMsg));
+    }
+}
+
+void ToolsMsgMgrImpl::setSearchIndexEnabled(bool enabled)
+{
+    if (isSearchIndexEnabled() == enabled) {
+        return;
+    }
+
+    if (!enabled) {
+        m_searchIndex.reset();
+        return;
+    }
+
+    m_searchIndex = std::make_unique<ToolsMsgIndex>();
+    if (!m_compactHistoryEnabled) {
+        for (auto& m : m_allMsgs) {
+            assert(m);
+            m_searchIndex->addMsg(SeqNumber().getFrom(*m), m);
+        }
+        return;
+    }
+
+    auto count = m_compact.m_msgNums.size();
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        auto msg = compactDecodeMsg(idx);
+        if (msg) {
+            m_searchIndex->addMsg(m_compact.m_msgNums[idx], std::move(msg));
+        }
+    }
+}
+
+bool ToolsMsgMgrImpl::searchMsgs(const QString& query, SearchMsgNumbersList& result, QString& error)
+{
+    if (!m_searchIndex) {
+        result.clear();
+        error = tr("Search index is disabled");
+        return false;
+    }
+
+    return m_searchIndex->search(query, result, error);
+}
+
+ToolsMessagesList ToolsMsgMgrImpl::findMsgs(const SearchMsgNumbersList& msgNums)
+{
+    assert(std::is_sorted(msgNums.begin(), msgNums.end()));
+    ToolsMessagesList result;
+    if (m_compactHistoryEnabled) {
+        for (auto msgNum : msgNums) {
+            auto idx = compactFindMsg(msgNum);
+            if (m_compact.m_msgNums.size() <= idx) {
+                continue;
+            }
+
+            auto msg = compactDecodeMsg(idx);
+            if (msg) {
+                result.push_back(std::move(msg));
+            }
+        }
+        return result;
+    }
+
+    for (auto msgNum : msgNums) {
+        auto iter = findStoredMsg(msgNum);
+        if (iter != m_allMsgsIndex.end()) {
+            result.push_back(*iter->second);
+        }
+    }
+
+    return result;
+}
+
+ToolsMessagePtr ToolsMsgMgrImpl::findMsg(ToolsMsgMgr::MsgNumberType msgNum)
+{
+    if (m_compactHistoryEnabled) {
+        auto idx = compactFindMsg(msgNum);
+        if (m_compact.m_msgNums.size() <= idx) {
+            return ToolsMessagePtr();
+        }
+
+        return compactDecodeMsg(idx);
+    }
+
+    auto iter = findStoredMsg(msgNum);
+    if (iter == m_allMsgsIndex.end()) {
+        return ToolsMessagePtr();
+    }
+
+    return *iter->second;
+}
+
+void ToolsMsgMgrImpl::clearStats()
+{
+    m_stats.clear();
+}
+
+void ToolsMsgMgrImpl::correlateStoredMsgs()
+{
+    if (!m_compactHistoryEnabled) {
+        m_correlator.process(m_allMsgs);
+        return;
+    }
+
+    // The messages are decoded one at a time
+    m_correlator.clear();
+    for (std::size_t idx = 0U; idx < m_compact.m_msgNums.size(); ++idx) {
+        auto msg = compactDecodeMsg(idx);
+        if (msg) {
+            m_correlator.addMsg(*msg);
+        }
     }
+
+    m_correlator.expireAccounted();
+}
+
+ToolsMsgMgr::MsgNumberType ToolsMsgMgrImpl::getMsgNumber(const ToolsMessage& msg)
+{
+    return SeqNumber().getFrom(msg);
 }
 
 void ToolsMsgMgrImpl::setSocket(ToolsSocketPtr socket)
@@ -408,11 +679,31 @@ void ToolsMsgMgrImpl::socketDataReceived(ToolsDataInfoPtr dataInfoPtr)
             updateMsgTimestamp(*m, now);
         }
 
+        // The size of the frame is recorded when it's read
+        std::size_t recvBytes = property::message::ToolsMsgFrameSize().getFrom(*m);
+        m_stats.addMsg(*m, recvBytes);
+        m_correlator.addMsg(*m);
+
         m_protocol->messageReceivedReport(m);
         reportMsgAdded(m);
     }
 
-    m_allMsgs.splice(m_allMsgs.end(), std::move(msgsList));
+    if (m_searchIndex) {
+        for (auto& m : msgsList) {
+            m_searchIndex->addMsg(SeqNumber().getFrom(*m), m);
+        }
+    }
+
+    if (!m_compactHistoryEnabled) {
+        auto firstIter = msgsList.begin();
+        m_allMsgs.splice(m_allMsgs.end(), std::move(msgsList));
+        indexStoredMsgs(firstIter);
+        return;
+    }
+
+    for (auto& m : msgsList) {
+        compactStoreMsg(m);
+    }
 }
 
 void ToolsMsgMgrImpl::filterErrorReport(const QString& msg)
@@ -509,6 +800,249 @@ void ToolsMsgMgrImpl::updateInternalId(ToolsMessage& msg)
     assert(0 < m_nextMsgNum); // wrap around is not supported
 }
 
+void ToolsMsgMgrImpl::storeMsg(ToolsMessagePtr msg)
+{
+    // The stored message can be modified (e.g. comment), don't keep
+    // the cached encoded data.
+    if (property::message::ToolsMsgEncodedData().getFrom(*msg)) {
+        property::message::ToolsMsgEncodedData().setTo(ToolsDataInfoPtr(), *msg);
+    }
+
+    if (m_searchIndex) {
+        m_searchIndex->addMsg(SeqNumber().getFrom(*msg), msg);
+    }
+
+    if (m_compactHistoryEnabled) {
+        compactStoreMsg(msg);
+        return;
+    }
+
+    m_allMsgs.push_back(std::move(msg));
+    indexStoredMsgs(std::prev(m_allMsgs.end()));
+}
+
+void ToolsMsgMgrImpl::indexStoredMsgs(ToolsMessagesList::iterator from)
+{
+    for (auto iter = from; iter != m_allMsgs.end(); ++iter) {
+        auto msgNum = SeqNumber().getFrom(**iter);
+        assert(m_allMsgsIndex.empty() || (m_allMsgsIndex.back().first < msgNum));
+        m_allMsgsIndex.emplace_back(msgNum, iter);
+    }
+}
+
+ToolsMsgMgrImpl::AllMsgsIndex::iterator ToolsMsgMgrImpl::findStoredMsg(MsgNumberType msgNum)
+{
+    auto iter =
+        std::lower_bound(
+            m_allMsgsIndex.begin(), m_allMsgsIndex.end(), msgNum,
+            [](const auto& elem, MsgNumberType num)
+            {
+                return elem.first < num;
+            });
+
+    if ((iter == m_allMsgsIndex.end()) || (iter->first != msgNum)) {
+        return m_allMsgsIndex.end();
+    }
+
+    return iter;
+}
+
+void ToolsMsgMgrImpl::compactStoreMsg(const ToolsMessagePtr& msg)
+{
+    assert(msg);
+    auto& c = m_compact;
+    auto msgNum = SeqNumber().getFrom(*msg);
+    assert(c.m_msgNums.empty() || (c.m_msgNums.back() < msgNum));
+
+    auto rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(*msg);
+    if ((!rawDataMsg) && m_protocol) {
+        m_protocol->updateMessage(*msg);
+        rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(*msg);
+    }
+
+    std::uint8_t flags = 0U;
+    if (msg->isValid()) {
+        flags |= CompactFlag_Valid;
+    }
+
+    if (msg->idAsString().isEmpty()) {
+        flags |= CompactFlag_Garbage;
+    }
+
+    unsigned extraInfoIdx = 0U;
+    auto extraInfo = property::message::ToolsMsgExtraInfo().getFrom(*msg);
+    if (!extraInfo.isEmpty()) {
+        if (c.m_extraInfos.empty() || (c.m_extraInfos.back() != extraInfo)) {
+            c.m_extraInfos.push_back(std::move(extraInfo));
+        }
+
+        extraInfoIdx = static_cast<unsigned>(c.m_extraInfos.size());
+    }
+
+    c.m_msgNums.push_back(msgNum);
+    c.m_timestamps.push_back(property::message::ToolsMsgTimestamp().getFrom(*msg));
+    c.m_ids.push_back(msg->numericId());
+    c.m_idxs.push_back(property::message::ToolsMsgIdx().getFrom(*msg));
+    c.m_types.push_back(static_cast<std::uint8_t>(property::message::ToolsMsgType().getFrom(*msg)));
+    c.m_flags.push_back(flags);
+    c.m_extraInfoIdxs.push_back(extraInfoIdx);
+    c.m_dataOffsets.push_back(c.m_data.size());
+    if (rawDataMsg) {
+        auto data = rawDataMsg->encodeData();
+        c.m_data.insert(c.m_data.end(), data.begin(), data.end());
+    }
+
+    auto comment = property::message::ToolsMsgComment().getFrom(*msg);
+    if (!comment.isEmpty()) {
+        c.m_comments.insert(msgNum, comment);
+    }
+
+    // Keep track of the message object while it is still referenced elsewhere
+    c.m_decoded.insert(msgNum, msg);
+    if (static_cast<std::size_t>(c.m_decoded.size()) < c.m_decodedPruneLimit) {
+        return;
+    }
+
+    for (auto iter = c.m_decoded.begin(); iter != c.m_decoded.end();) {
+        if (iter.value().expired()) {
+            iter = c.m_decoded.erase(iter);
+            continue;
+        }
+
+        ++iter;
+    }
+
+    c.m_decodedPruneLimit = std::max(MinDecodedPruneLimit, static_cast<std::size_t>(c.m_decoded.size()) * 2U);
+}
+
+ToolsMessagePtr ToolsMsgMgrImpl::compactDecodeMsg(std::size_t idx)
+{
+    auto& c = m_compact;
+    assert(idx < c.m_msgNums.size());
+    auto msgNum = c.m_msgNums[idx];
+    auto msg = c.m_decoded.value(msgNum).lock();
+    if (msg || (!m_protocol)) {
+        return msg;
+    }
+
+    auto dataBeg = c.m_dataOffsets[idx];
+    auto dataEnd = c.m_data.size();
+    if ((idx + 1U) < c.m_dataOffsets.size()) {
+        dataEnd = c.m_dataOffsets[idx + 1U];
+    }
+
+    assert(dataBeg <= dataEnd);
+    ToolsDataInfo dataInfo;
+    dataInfo.m_data.assign(c.m_data.begin() + static_cast<std::intmax_t>(dataBeg), c.m_data.begin() + static_cast<std::intmax_t>(dataEnd));
+
+    auto extraInfoIdx = c.m_extraInfoIdxs[idx];
+    if (0U < extraInfoIdx) {
+        assert(extraInfoIdx <= c.m_extraInfos.size());
+        dataInfo.m_extraProperties = c.m_extraInfos[extraInfoIdx - 1U];
+    }
+
+    if ((c.m_flags[idx] & CompactFlag_Garbage) != 0U) {
+        msg = m_protocol->createInvalidMessage(dataInfo.m_data);
+        if (msg && (!dataInfo.m_extraProperties.isEmpty())) {
+            property::message::ToolsMsgExtraInfo().setTo(dataInfo.m_extraProperties, *msg);
+        }
+    }
+    else {
+        msg = m_protocol->decodeMessage(dataInfo);
+    }
+
+    if (!msg) {
+        return msg;
+    }
+
+    SeqNumber().setTo(msgNum, *msg);
+    property::message::ToolsMsgType().setTo(static_cast<MsgType>(c.m_types[idx]), *msg);
+    property::message::ToolsMsgTimestamp().setTo(c.m_timestamps[idx], *msg);
+    property::message::ToolsMsgIdx().setTo(c.m_idxs[idx], *msg);
+
+    auto commentIter = c.m_comments.find(msgNum);
+    if (commentIter != c.m_comments.end()) {
+        property::message::ToolsMsgComment().setTo(commentIter.value(), *msg);
+    }
+
+    c.m_decoded.insert(msgNum, msg);
+    return msg;
+}
+
+std::size_t ToolsMsgMgrImpl::compactFindMsg(MsgNumberType msgNum) const
+{
+    auto& msgNums = m_compact.m_msgNums;
+    auto iter = std::lower_bound(msgNums.begin(), msgNums.end(), msgNum);
+    if ((iter == msgNums.end()) || (*iter != msgNum)) {
+        return msgNums.size();
+    }
+
+    return static_cast<std::size_t>(std::distance(msgNums.begin(), iter));
+}
+
+void ToolsMsgMgrImpl::compactDeleteMsgs(MsgNumbersList&& msgNums)
+{
+    auto& c = m_compact;
+    std::sort(msgNums.begin(), msgNums.end());
+
+    // Single pass moving the retained entries towards the front
+    auto count = c.m_msgNums.size();
+    auto delIter = msgNums.begin();
+    std::size_t writeIdx = 0U;
+    std::size_t dataWritePos = 0U;
+    for (std::size_t readIdx = 0U; readIdx < count; ++readIdx) {
+        auto msgNum = c.m_msgNums[readIdx];
+        auto dataBeg = c.m_dataOffsets[readIdx];
+        auto dataEnd = c.m_data.size();
+        if ((readIdx + 1U) < count) {
+            dataEnd = c.m_dataOffsets[readIdx + 1U];
+        }
+
+        delIter = std::lower_bound(delIter, msgNums.end(), msgNum);
+        if ((delIter != msgNums.end()) && (*delIter == msgNum)) {
+            c.m_comments.remove(msgNum);
+            c.m_decoded.remove(msgNum);
+            continue;
+        }
+
+        if (writeIdx != readIdx) {
+            c.m_msgNums[writeIdx] = msgNum;
+            c.m_timestamps[writeIdx] = c.m_timestamps[readIdx];
+            c.m_ids[writeIdx] = c.m_ids[readIdx];
+            c.m_idxs[writeIdx] = c.m_idxs[readIdx];
+            c.m_types[writeIdx] = c.m_types[readIdx];
+            c.m_flags[writeIdx] = c.m_flags[readIdx];
+            c.m_extraInfoIdxs[writeIdx] = c.m_extraInfoIdxs[readIdx];
+        }
+
+        if (dataWritePos != dataBeg) {
+            std::copy(
+                c.m_data.begin() + static_cast<std::intmax_t>(dataBeg),
+                c.m_data.begin() + static_cast<std::intmax_t>(dataEnd),
+                c.m_data.begin() + static_cast<std::intmax_t>(dataWritePos));
+        }
+
+        c.m_dataOffsets[writeIdx] = dataWritePos;
+        dataWritePos += (dataEnd - dataBeg);
+        ++writeIdx;
+    }
+
+    c.m_msgNums.resize(writeIdx);
+    c.m_timestamps.resize(writeIdx);
+    c.m_ids.resize(writeIdx);
+    c.m_idxs.resize(writeIdx);
+    c.m_types.resize(writeIdx);
+    c.m_flags.resize(writeIdx);
+    c.m_extraInfoIdxs.resize(writeIdx);
+    c.m_dataOffsets.resize(writeIdx);
+    c.m_data.resize(dataWritePos);
+}
+
+void ToolsMsgMgrImpl::compactClear()
+{
+    m_compact = CompactHistory();
+}
+
 void ToolsMsgMgrImpl::reportMsgAdded(ToolsMessagePtr msg)
 {
     if (m_msgAddedCallback) {
@@ -21,7 +21,14 @@
 #include "cc_tools_qt/ToolsMsgMgr.h"
 
 #include <QtCore/QObject>
-
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVariantMap>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace cc_tools_qt
@@ -46,10 +53,7 @@ public:
 
     void deleteMsg(ToolsMessagePtr msg);
     void deleteMsgs(const ToolsMessagesList& msgs);
-    void deleteAllMsgs()
-    {
-        m_allMsgs.clear();
-    }
+    void deleteAllMsgs();
 
     void sendMsgs(ToolsMessagesList&& msgs);
 
@@ -60,6 +64,43 @@ public:
 
     void addMsgs(const ToolsMessagesList& msgs, bool reportAdded);
 
+    void setCompactHistoryEnabled(bool enabled);
+    bool isCompactHistoryEnabled() const
+    {
+        return m_compactHistoryEnabled;
+    }
+
+    std::size_t getMsgsCount() const;
+    ToolsMessagePtr getMsg(std::size_t idx);
+    void updateMsgComment(const ToolsMessage& msg);
+
+    using SearchMsgNumbersList = ToolsMsgMgr::MsgNumbersList;
+    void setSearchIndexEnabled(bool enabled);
+    bool isSearchIndexEnabled() const
+    {
+        return static_cast<bool>(m_searchIndex);
+    }
+
+    bool searchMsgs(const QString& query, SearchMsgNumbersList& result, QString& error);
+    ToolsMessagesList findMsgs(const SearchMsgNumbersList& msgNums);
+    ToolsMessagePtr findMsg(ToolsMsgMgr::MsgNumberType msgNum);
+    void deleteMsgs(const SearchMsgNumbersList& msgNums);
+    static ToolsMsgMgr::MsgNumberType getMsgNumber(const ToolsMessage& msg);
+
+    const ToolsMsgStats& getStats() const
+    {
+        return m_stats;
+    }
+
+    void clearStats();
+
+    ToolsMsgCorrelator& getCorrelator()
+    {
+        return m_correlator;
+    }
+
+    void correlateStoredMsgs();
+
     void setSocket(ToolsSocketPtr socket);
     void setProtocol(ToolsProtocolPtr protocol);
     void addFilter(ToolsFilterPtr filter);
@@ -98,13 +139,46 @@ private slots:
 private:
     using MsgNumberType = unsigned long long;
     using FiltersList = std::vector<ToolsFilterPtr>;
+    using MsgNumbersList = std::vector<MsgNumberType>;
+
+    // Raw frame bytes and fixed size metadata of the stored messages
+    // kept in contiguous arrays, the message objects are decoded on demand.
+    struct CompactHistory
+    {
+        MsgNumbersList m_msgNums;
+        std::vector<unsigned long long> m_timestamps;
+        std::vector<qlonglong> m_ids;
+        std::vector<unsigned> m_idxs;
+        std::vector<std::uint8_t> m_types;
+        std::vector<std::uint8_t> m_flags;
+        std::vector<unsigned> m_extraInfoIdxs;
+        std::vector<std::size_t> m_dataOffsets;
+        ToolsMessage::DataSeq m_data;
+        std::vector<QVariantMap> m_extraInfos;
+        QHash<MsgNumberType, QString> m_comments;
+        QHash<MsgNumberType, std::weak_ptr<ToolsMessage>> m_decoded;
+        std::size_t m_decodedPruneLimit = 0U;
+    };
+
+    // Positions of the messages in m_allMsgs sorted by the message number,
+    // allow resolving the messages by number without traversing the list.
+    using AllMsgsIndex = std::vector<std::pair<MsgNumberType, ToolsMessagesList::iterator> >;
 
     void updateInternalId(ToolsMessage& msg);
+    void storeMsg(ToolsMessagePtr msg);
+    void indexStoredMsgs(ToolsMessagesList::iterator from);
+    AllMsgsIndex::iterator findStoredMsg(MsgNumberType msgNum);
+    void compactStoreMsg(const ToolsMessagePtr& msg);
+    ToolsMessagePtr compactDecodeMsg(std::size_t idx);
+    std::size_t compactFindMsg(MsgNumberType msgNum) const;
+    void compactDeleteMsgs(MsgNumbersList&& msgNums);
+    void compactClear();
     void reportMsgAdded(ToolsMessagePtr msg);
     void reportError(const QString& error);
     void reportSocketConnectionStatus(bool connected);
 
     ToolsMessagesList m_allMsgs;
+    AllMsgsIndex m_allMsgsIndex;
     bool m_recvEnabled = false;
 
     ToolsSocketPtr m_socket;
@@ -112,6 +186,11 @@ private:
     FiltersList m_filters;
     MsgNumberType m_nextMsgNum = 1;
     bool m_running = false;
+    bool m_compactHistoryEnabled = false;
+    CompactHistory m_compact;
+    std::unique_ptr<ToolsMsgIndex> m_searchIndex;
+    ToolsMsgStats m_stats;
+    ToolsMsgCorrelator m_correlator;
 
     MsgAddedCallbackFunc m_msgAddedCallback;
     ErrorReportCallbackFunc m_errorReportCallback;
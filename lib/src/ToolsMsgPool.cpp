@@ -0,0 +1,99 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "cc_tools_qt/ToolsMsgPool.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QVariant>
+
+#include <cassert>
+
+namespace cc_tools_qt
+{
+
+ToolsMsgPool::ToolsMsgPool(std::size_t typesCount) :
+    m_free(typesCount),
+    m_thread(QThread::currentThread())
+{
+}
+
+ToolsMsgPool::~ToolsMsgPool() noexcept = default;
+
+ToolsMessage::Ptr ToolsMsgPool::take(std::size_t typeIdx)
+{
+    assert(typeIdx < m_free.size());
+    if (QThread::currentThread() != m_thread) {
+        return ToolsMessage::Ptr();
+    }
+
+    auto& freeList = m_free[typeIdx];
+    if (freeList.empty()) {
+        return ToolsMessage::Ptr();
+    }
+
+    auto msg = std::move(freeList.back());
+    freeList.pop_back();
+    return msg;
+}
+
+ToolsMessagePtr ToolsMsgPool::wrap(std::size_t typeIdx, ToolsMessage::Ptr msg)
+{
+    assert(typeIdx < m_free.size());
+    std::weak_ptr<ToolsMsgPool> weakPool = shared_from_this();
+    return
+        ToolsMessagePtr(
+            msg.release(),
+            [weakPool, typeIdx](ToolsMessage* m)
+            {
+                auto pool = weakPool.lock();
+                if (!pool) {
+                    delete m;
+                    return;
+                }
+
+                pool->recycle(typeIdx, m);
+            });
+}
+
+void ToolsMsgPool::recycle(std::size_t typeIdx, ToolsMessage* msg)
+{
+    ToolsMessage::Ptr msgPtr(msg);
+    assert(typeIdx < m_free.size());
+    if (QThread::currentThread() != m_thread) {
+        // The free lists are not thread safe, just delete the object
+        return;
+    }
+
+    auto& freeList = m_free[typeIdx];
+    if (MaxPooledPerType <= freeList.size()) {
+        return;
+    }
+
+    // Remove all the properties to make it look like a newly created one
+    auto propNames = msgPtr->dynamicPropertyNames();
+    for (auto& name : propNames) {
+        msgPtr->setProperty(name.constData(), QVariant());
+    }
+
+    msgPtr->reset();
+    freeList.push_back(std::move(msgPtr));
+}
+
+}  // namespace cc_tools_qt
+
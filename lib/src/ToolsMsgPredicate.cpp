@@ -0,0 +1,1060 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cc_tools_qt/ToolsMsgPredicate.h"
+
+#include "cc_tools_qt/ToolsFieldHandler.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+enum class TokenType
+{
+    End,
+    Ident,
+    Number,
+    String,
+    Dot,
+    LBracket,
+    RBracket,
+    LParen,
+    RParen,
+    Star,
+    Minus,
+    And,
+    Or,
+    Not,
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+};
+
+struct Token
+{
+    TokenType m_type = TokenType::End;
+    QString m_text;
+    int m_pos = 0;
+};
+
+using TokensList = std::vector<Token>;
+
+struct Value
+{
+    enum class Kind
+    {
+        None,
+        Int,
+        UInt,
+        Double,
+        String
+    };
+
+    Kind m_kind = Kind::None;
+    long long m_int = 0;
+    unsigned long long m_uint = 0U;
+    double m_double = 0.0;
+    QString m_str; // Also name of the enum value
+};
+
+enum class CmpOp
+{
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    Contains
+};
+
+struct Operand
+{
+    int m_pathIdx = -1; // Literal when negative
+    Value m_literal;
+};
+
+struct Node
+{
+    enum class Kind
+    {
+        Or,
+        And,
+        Not,
+        Compare,
+        Truthy
+    };
+
+    Kind m_kind = Kind::Truthy;
+    CmpOp m_op = CmpOp::Eq;
+    int m_lhs = -1;
+    int m_rhs = -1;
+    Operand m_left;
+    Operand m_right;
+};
+
+struct PathElem
+{
+    QByteArray m_name;
+    int m_index = -1;
+    std::size_t m_hint = 0U;
+};
+
+struct Path
+{
+    QByteArray m_msgName; // Empty means any message
+    std::vector<PathElem> m_elems;
+};
+
+QByteArray normalisedName(const QString& name)
+{
+    auto str = name;
+    str.remove(QChar(' '));
+    return str.toUtf8();
+}
+
+bool namesMatch(const char* name, const QByteArray& expected)
+{
+    if (name == nullptr) {
+        return false;
+    }
+
+    auto* expIter = expected.constData();
+    auto* expEnd = expIter + expected.size();
+    for (; *name != '\0'; ++name) {
+        if (*name == ' ') {
+            continue;
+        }
+
+        if ((expIter == expEnd) || (*expIter != *name)) {
+            return false;
+        }
+
+        ++expIter;
+    }
+
+    return expIter == expEnd;
+}
+
+bool isIdentChar(QChar ch)
+{
+    return ch.isLetterOrNumber() || (ch == QChar('_'));
+}
+
+bool tokenize(const QString& expr, TokensList& tokens, QString& error)
+{
+    static const struct
+    {
+        const char* m_str;
+        TokenType m_type;
+    } Operators[] = {
+        {"&&", TokenType::And},
+        {"||", TokenType::Or},
+        {"==", TokenType::Eq},
+        {"!=", TokenType::Ne},
+        {"<=", TokenType::Le},
+        {">=", TokenType::Ge},
+        {"<", TokenType::Lt},
+        {">", TokenType::Gt},
+        {"!", TokenType::Not},
+        {"=", TokenType::Eq},
+        {".", TokenType::Dot},
+        {"[", TokenType::LBracket},
+        {"]", TokenType::RBracket},
+        {"(", TokenType::LParen},
+        {")", TokenType::RParen},
+        {"*", TokenType::Star},
+        {"-", TokenType::Minus},
+    };
+
+    int pos = 0;
+    auto len = static_cast<int>(expr.size());
+    while (pos < len) {
+        auto ch = expr[pos];
+        if (ch.isSpace()) {
+            ++pos;
+            continue;
+        }
+
+        Token token;
+        token.m_pos = pos;
+
+        if (ch.isDigit()) {
+            auto endPos = pos + 1;
+            while ((endPos < len) && (isIdentChar(expr[endPos]) || (expr[endPos] == QChar('.')))) {
+                ++endPos;
+            }
+
+            token.m_type = TokenType::Number;
+            token.m_text = expr.mid(pos, endPos - pos);
+            tokens.push_back(std::move(token));
+            pos = endPos;
+            continue;
+        }
+
+        if (isIdentChar(ch)) {
+            auto endPos = pos + 1;
+            while ((endPos < len) && isIdentChar(expr[endPos])) {
+                ++endPos;
+            }
+
+            token.m_type = TokenType::Ident;
+            token.m_text = expr.mid(pos, endPos - pos);
+            tokens.push_back(std::move(token));
+            pos = endPos;
+            continue;
+        }
+
+        if (ch == QChar('"')) {
+            auto endPos = pos + 1;
+            QString str;
+            while ((endPos < len) && (expr[endPos] != QChar('"'))) {
+                if ((expr[endPos] == QChar('\\')) && ((endPos + 1) < len)) {
+                    ++endPos;
+                }
+
+                str.append(expr[endPos]);
+                ++endPos;
+            }
+
+            if (len <= endPos) {
+                error = QObject::tr("Unterminated string at position %1").arg(pos);
+                return false;
+            }
+
+            token.m_type = TokenType::String;
+            token.m_text = std::move(str);
+            tokens.push_back(std::move(token));
+            pos = endPos + 1;
+            continue;
+        }
+
+        auto opIter =
+            std::find_if(
+                std::begin(Operators), std::end(Operators),
+                [&expr, pos](auto& info)
+                {
+                    return expr.mid(pos).startsWith(QLatin1String(info.m_str));
+                });
+
+        if (opIter == std::end(Operators)) {
+            error = QObject::tr("Unexpected character '%1' at position %2").arg(ch).arg(pos);
+            return false;
+        }
+
+        token.m_type = opIter->m_type;
+        token.m_text = QString::fromLatin1(opIter->m_str);
+        pos += static_cast<int>(token.m_text.size());
+        tokens.push_back(std::move(token));
+    }
+
+    Token endToken;
+    endToken.m_pos = len;
+    tokens.push_back(std::move(endToken));
+    return true;
+}
+
+bool parseNumber(const QString& text, bool negative, Value& value)
+{
+    auto str = text;
+    if (negative) {
+        str.prepend(QChar('-'));
+    }
+
+    bool ok = false;
+    auto intVal = str.toLongLong(&ok, 0);
+    if (ok) {
+        value.m_kind = Value::Kind::Int;
+        value.m_int = intVal;
+        return true;
+    }
+
+    auto uintVal = str.toULongLong(&ok, 0);
+    if (ok) {
+        value.m_kind = Value::Kind::UInt;
+        value.m_uint = uintVal;
+        return true;
+    }
+
+    auto doubleVal = str.toDouble(&ok);
+    if (ok) {
+        value.m_kind = Value::Kind::Double;
+        value.m_double = doubleVal;
+        return true;
+    }
+
+    return false;
+}
+
+class ValueExtractor : public ToolsFieldHandler
+{
+public:
+    explicit ValueExtractor(Value& value) : m_value(value) {}
+
+    virtual void handle(field::ToolsArrayListField& field) override
+    {
+        setUnsigned(field.size());
+    }
+
+    virtual void handle(field::ToolsBitmaskField& field) override
+    {
+        setUnsigned(field.getValue());
+    }
+
+    virtual void handle(field::ToolsEnumField& field) override
+    {
+        m_value.m_kind = Value::Kind::Int;
+        m_value.m_int = field.getValue();
+        auto& values = field.values();
+        auto iter =
+            std::find_if(
+                values.begin(), values.end(),
+                [this](auto& info)
+                {
+                    return info.second == m_value.m_int;
+                });
+
+        if (iter != values.end()) {
+            m_value.m_str = iter->first;
+        }
+    }
+
+    virtual void handle(field::ToolsFloatField& field) override
+    {
+        m_value.m_kind = Value::Kind::Double;
+        m_value.m_double = field.getValue();
+    }
+
+    virtual void handle(field::ToolsIntField& field) override
+    {
+        m_value.m_kind = Value::Kind::Int;
+        m_value.m_int = field.getValue();
+    }
+
+    virtual void handle(field::ToolsRawDataField& field) override
+    {
+        setString(field.getValue());
+    }
+
+    virtual void handle(field::ToolsStringField& field) override
+    {
+        setString(field.getValue());
+    }
+
+    virtual void handle(field::ToolsUnknownField& field) override
+    {
+        setString(field.getSerialisedString());
+    }
+
+    virtual void handle(field::ToolsUnsignedLongField& field) override
+    {
+        setUnsigned(field.getValue());
+    }
+
+    virtual void handle([[maybe_unused]] ToolsField& field) override
+    {
+    }
+
+private:
+    void setUnsigned(unsigned long long value)
+    {
+        m_value.m_kind = Value::Kind::UInt;
+        m_value.m_uint = value;
+    }
+
+    void setString(QString&& value)
+    {
+        m_value.m_kind = Value::Kind::String;
+        m_value.m_str = std::move(value);
+    }
+
+    Value& m_value;
+};
+
+QString toString(const Value& value)
+{
+    switch (value.m_kind) {
+        case Value::Kind::Int:
+            if (!value.m_str.isEmpty()) {
+                return value.m_str;
+            }
+            return QString::number(value.m_int);
+        case Value::Kind::UInt: return QString::number(value.m_uint);
+        case Value::Kind::Double: return QString::number(value.m_double);
+        case Value::Kind::String: return value.m_str;
+        default: break;
+    }
+
+    return QString();
+}
+
+double toDouble(const Value& value)
+{
+    switch (value.m_kind) {
+        case Value::Kind::Int: return static_cast<double>(value.m_int);
+        case Value::Kind::UInt: return static_cast<double>(value.m_uint);
+        case Value::Kind::Double: return value.m_double;
+        default: break;
+    }
+
+    return 0.0;
+}
+
+template <typename T>
+int compareRaw(T lhs, T rhs)
+{
+    if (lhs < rhs) {
+        return -1;
+    }
+
+    if (rhs < lhs) {
+        return 1;
+    }
+
+    return 0;
+}
+
+int compareIntegral(const Value& lhs, const Value& rhs)
+{
+    if (lhs.m_kind == rhs.m_kind) {
+        if (lhs.m_kind == Value::Kind::Int) {
+            return compareRaw(lhs.m_int, rhs.m_int);
+        }
+
+        return compareRaw(lhs.m_uint, rhs.m_uint);
+    }
+
+    if (lhs.m_kind == Value::Kind::Int) {
+        if (lhs.m_int < 0) {
+            return -1;
+        }
+
+        return compareRaw(static_cast<unsigned long long>(lhs.m_int), rhs.m_uint);
+    }
+
+    return -compareIntegral(rhs, lhs);
+}
+
+bool compareValues(const Value& lhs, CmpOp op, const Value& rhs)
+{
+    if ((lhs.m_kind == Value::Kind::None) || (rhs.m_kind == Value::Kind::None)) {
+        return false;
+    }
+
+    if (op == CmpOp::Contains) {
+        return toString(lhs).contains(toString(rhs));
+    }
+
+    bool isIntegral =
+        ((lhs.m_kind == Value::Kind::Int) || (lhs.m_kind == Value::Kind::UInt)) &&
+        ((rhs.m_kind == Value::Kind::Int) || (rhs.m_kind == Value::Kind::UInt));
+
+    bool isString = (lhs.m_kind == Value::Kind::String) || (rhs.m_kind == Value::Kind::String);
+
+    int cmp = 0;
+    if (isString) {
+        cmp = QString::compare(toString(lhs), toString(rhs));
+    }
+    else if (isIntegral) {
+        cmp = compareIntegral(lhs, rhs);
+    }
+    else {
+        auto lhsVal = toDouble(lhs);
+        auto rhsVal = toDouble(rhs);
+        if (std::isnan(lhsVal) || std::isnan(rhsVal)) {
+            return op == CmpOp::Ne;
+        }
+
+        cmp = compareRaw(lhsVal, rhsVal);
+    }
+
+    switch (op) {
+        case CmpOp::Eq: return cmp == 0;
+        case CmpOp::Ne: return cmp != 0;
+        case CmpOp::Lt: return cmp < 0;
+        case CmpOp::Le: return cmp <= 0;
+        case CmpOp::Gt: return 0 < cmp;
+        case CmpOp::Ge: return 0 <= cmp;
+        default: break;
+    }
+
+    [[maybe_unused]] static constexpr bool Unexpected_operation = false;
+    assert(Unexpected_operation);
+    return false;
+}
+
+bool isTruthy(const Value& value)
+{
+    switch (value.m_kind) {
+        case Value::Kind::Int: return value.m_int != 0;
+        case Value::Kind::UInt: return value.m_uint != 0U;
+        case Value::Kind::Double: return value.m_double != 0.0;
+        case Value::Kind::String: return !value.m_str.isEmpty();
+        default: break;
+    }
+
+    return false;
+}
+
+ToolsField* unwrapOptional(ToolsField* field)
+{
+    while (field != nullptr) {
+        auto* optField = dynamic_cast<field::ToolsOptionalField*>(field);
+        if (optField == nullptr) {
+            break;
+        }
+
+        if ((optField->getMode() != field::ToolsOptionalField::Mode::Exists) || (!optField->hasField())) {
+            return nullptr;
+        }
+
+        field = &optField->getField();
+    }
+
+    return field;
+}
+
+class Parser
+{
+public:
+    Parser(const TokensList& tokens, std::vector<Node>& nodes, std::vector<Path>& paths) :
+        m_tokens(tokens),
+        m_nodes(nodes),
+        m_paths(paths)
+    {
+    }
+
+    int parse()
+    {
+        auto idx = parseOr();
+        if ((0 <= idx) && (current().m_type != TokenType::End)) {
+            return fail(QObject::tr("Unexpected \"%1\" at position %2").arg(current().m_text).arg(current().m_pos));
+        }
+
+        return idx;
+    }
+
+    const QString& error() const
+    {
+        return m_error;
+    }
+
+private:
+    const Token& current() const
+    {
+        assert(m_pos < m_tokens.size());
+        return m_tokens[m_pos];
+    }
+
+    bool accept(TokenType type)
+    {
+        if (current().m_type != type) {
+            return false;
+        }
+
+        ++m_pos;
+        return true;
+    }
+
+    int fail(const QString& msg)
+    {
+        if (m_error.isEmpty()) {
+            m_error = msg;
+        }
+
+        return -1;
+    }
+
+    int failUnexpected()
+    {
+        if (current().m_type == TokenType::End) {
+            return fail(QObject::tr("Unexpected end of expression"));
+        }
+
+        return fail(QObject::tr("Unexpected \"%1\" at position %2").arg(current().m_text).arg(current().m_pos));
+    }
+
+    int addNode(Node&& node)
+    {
+        m_nodes.push_back(std::move(node));
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+
+    int parseOr()
+    {
+        auto lhs = parseAnd();
+        while ((0 <= lhs) && accept(TokenType::Or)) {
+            auto rhs = parseAnd();
+            if (rhs < 0) {
+                return rhs;
+            }
+
+            Node node;
+            node.m_kind = Node::Kind::Or;
+            node.m_lhs = lhs;
+            node.m_rhs = rhs;
+            lhs = addNode(std::move(node));
+        }
+
+        return lhs;
+    }
+
+    int parseAnd()
+    {
+        auto lhs = parseUnary();
+        while ((0 <= lhs) && accept(TokenType::And)) {
+            auto rhs = parseUnary();
+            if (rhs < 0) {
+                return rhs;
+            }
+
+            Node node;
+            node.m_kind = Node::Kind::And;
+            node.m_lhs = lhs;
+            node.m_rhs = rhs;
+            lhs = addNode(std::move(node));
+        }
+
+        return lhs;
+    }
+
+    int parseUnary()
+    {
+        if (accept(TokenType::Not)) {
+            auto operand = parseUnary();
+            if (operand < 0) {
+                return operand;
+            }
+
+            Node node;
+            node.m_kind = Node::Kind::Not;
+            node.m_lhs = operand;
+            return addNode(std::move(node));
+        }
+
+        if (accept(TokenType::LParen)) {
+            auto idx = parseOr();
+            if (idx < 0) {
+                return idx;
+            }
+
+            if (!accept(TokenType::RParen)) {
+                return failUnexpected();
+            }
+
+            return idx;
+        }
+
+        return parseComparison();
+    }
+
+    int parseComparison()
+    {
+        Node node;
+        if (!parseOperand(node.m_left)) {
+            return -1;
+        }
+
+        static const struct
+        {
+            TokenType m_type;
+            CmpOp m_op;
+        } Ops[] = {
+            {TokenType::Eq, CmpOp::Eq},
+            {TokenType::Ne, CmpOp::Ne},
+            {TokenType::Lt, CmpOp::Lt},
+            {TokenType::Le, CmpOp::Le},
+            {TokenType::Gt, CmpOp::Gt},
+            {TokenType::Ge, CmpOp::Ge},
+        };
+
+        auto& tok = current();
+        auto opIter =
+            std::find_if(
+                std::begin(Ops), std::end(Ops),
+                [&tok](auto& info)
+                {
+                    return info.m_type == tok.m_type;
+                });
+
+        bool isContains = (tok.m_type == TokenType::Ident) && (tok.m_text == QLatin1String("contains"));
+        if ((opIter == std::end(Ops)) && (!isContains)) {
+            if (node.m_left.m_pathIdx < 0) {
+                return failUnexpected();
+            }
+
+            node.m_kind = Node::Kind::Truthy;
+            return addNode(std::move(node));
+        }
+
+        ++m_pos;
+        node.m_kind = Node::Kind::Compare;
+        node.m_op = CmpOp::Contains;
+        if (opIter != std::end(Ops)) {
+            node.m_op = opIter->m_op;
+        }
+
+        if (!parseOperand(node.m_right)) {
+            return -1;
+        }
+
+        return addNode(std::move(node));
+    }
+
+    bool parseOperand(Operand& operand)
+    {
+        if (current().m_type == TokenType::String) {
+            operand.m_literal.m_kind = Value::Kind::String;
+            operand.m_literal.m_str = current().m_text;
+            ++m_pos;
+            return true;
+        }
+
+        bool negative = accept(TokenType::Minus);
+        if (current().m_type == TokenType::Number) {
+            if (!parseNumber(current().m_text, negative, operand.m_literal)) {
+                fail(QObject::tr("Invalid number \"%1\" at position %2").arg(current().m_text).arg(current().m_pos));
+                return false;
+            }
+
+            ++m_pos;
+            return true;
+        }
+
+        if (negative) {
+            failUnexpected();
+            return false;
+        }
+
+        return parsePath(operand);
+    }
+
+    bool parsePath(Operand& operand)
+    {
+        Path path;
+        if (current().m_type == TokenType::Ident) {
+            path.m_msgName = normalisedName(current().m_text);
+        }
+        else if (current().m_type != TokenType::Star) {
+            failUnexpected();
+            return false;
+        }
+
+        ++m_pos;
+        while (true) {
+            if (accept(TokenType::Dot)) {
+                if (current().m_type != TokenType::Ident) {
+                    failUnexpected();
+                    return false;
+                }
+
+                PathElem elem;
+                elem.m_name = normalisedName(current().m_text);
+                path.m_elems.push_back(std::move(elem));
+                ++m_pos;
+                continue;
+            }
+
+            if (accept(TokenType::LBracket)) {
+                Value idxValue;
+                if ((current().m_type != TokenType::Number) ||
+                    (!parseNumber(current().m_text, false, idxValue)) ||
+                    (idxValue.m_kind != Value::Kind::Int)) {
+                    failUnexpected();
+                    return false;
+                }
+
+                ++m_pos;
+                if ((path.m_elems.empty()) || (!accept(TokenType::RBracket))) {
+                    failUnexpected();
+                    return false;
+                }
+
+                PathElem elem;
+                elem.m_index = static_cast<int>(idxValue.m_int);
+                path.m_elems.push_back(std::move(elem));
+                continue;
+            }
+
+            break;
+        }
+
+        if (path.m_elems.empty()) {
+            fail(QObject::tr("Field is not specified for \"%1\"").arg(QString::fromUtf8(path.m_msgName)));
+            return false;
+        }
+
+        m_paths.push_back(std::move(path));
+        operand.m_pathIdx = static_cast<int>(m_paths.size()) - 1;
+        return true;
+    }
+
+    const TokensList& m_tokens;
+    std::vector<Node>& m_nodes;
+    std::vector<Path>& m_paths;
+    std::size_t m_pos = 0U;
+    QString m_error;
+};
+
+}  // namespace
+
+struct ToolsMsgPredicate::InnerState
+{
+    QString m_expr;
+    QString m_error;
+    std::vector<Node> m_nodes;
+    std::vector<Path> m_paths;
+    int m_root = -1;
+
+    // Evaluation context
+    ToolsMessage* m_msg = nullptr;
+    ToolsMessage::FieldsList m_fields;
+    bool m_fieldsRetrieved = false;
+    std::vector<Value> m_pathValues;
+    std::vector<bool> m_pathValuesReady;
+
+    const Value& pathValue(int pathIdx);
+    bool evalOperand(const Operand& operand, const Value*& value);
+    bool evalNode(int idx);
+};
+
+const Value& ToolsMsgPredicate::InnerState::pathValue(int pathIdx)
+{
+    assert(static_cast<std::size_t>(pathIdx) < m_paths.size());
+    auto valIdx = static_cast<std::size_t>(pathIdx);
+    auto& value = m_pathValues[valIdx];
+    if (m_pathValuesReady[valIdx]) {
+        return value;
+    }
+
+    m_pathValuesReady[valIdx] = true;
+    value = Value();
+
+    auto& path = m_paths[valIdx];
+    assert(m_msg != nullptr);
+    if ((!path.m_msgName.isEmpty()) && (!namesMatch(m_msg->name(), path.m_msgName))) {
+        return value;
+    }
+
+    if (!m_fieldsRetrieved) {
+        m_fields = m_msg->payloadFields();
+        m_fieldsRetrieved = true;
+    }
+
+    ToolsField* field = nullptr;
+    auto* members = &m_fields;
+    for (auto& elem : path.m_elems) {
+        if (field != nullptr) {
+            field = unwrapOptional(field);
+            if (field == nullptr) {
+                return value;
+            }
+
+            members = &field->getMembers();
+        }
+
+        if (0 <= elem.m_index) {
+            if (members->size() <= static_cast<std::size_t>(elem.m_index)) {
+                return value;
+            }
+
+            field = (*members)[static_cast<std::size_t>(elem.m_index)].get();
+            continue;
+        }
+
+        // Check the member found last time first
+        if ((members->size() <= elem.m_hint) ||
+            (!namesMatch((*members)[elem.m_hint]->name(), elem.m_name))) {
+            auto iter =
+                std::find_if(
+                    members->begin(), members->end(),
+                    [&elem](auto& m)
+                    {
+                        return namesMatch(m->name(), elem.m_name);
+                    });
+
+            if (iter == members->end()) {
+                return value;
+            }
+
+            elem.m_hint = static_cast<std::size_t>(std::distance(members->begin(), iter));
+        }
+
+        field = (*members)[elem.m_hint].get();
+    }
+
+    field = unwrapOptional(field);
+    if (field == nullptr) {
+        return value;
+    }
+
+    ValueExtractor extractor(value);
+    field->dispatch(extractor);
+    return value;
+}
+
+bool ToolsMsgPredicate::InnerState::evalOperand(const Operand& operand, const Value*& value)
+{
+    if (operand.m_pathIdx < 0) {
+        value = &operand.m_literal;
+        return true;
+    }
+
+    value = &pathValue(operand.m_pathIdx);
+    return value->m_kind != Value::Kind::None;
+}
+
+bool ToolsMsgPredicate::InnerState::evalNode(int idx)
+{
+    assert(static_cast<std::size_t>(idx) < m_nodes.size());
+    auto& node = m_nodes[static_cast<std::size_t>(idx)];
+    switch (node.m_kind) {
+        case Node::Kind::Or: return evalNode(node.m_lhs) || evalNode(node.m_rhs);
+        case Node::Kind::And: return evalNode(node.m_lhs) && evalNode(node.m_rhs);
+        case Node::Kind::Not: return !evalNode(node.m_lhs);
+        case Node::Kind::Truthy:
+        {
+            const Value* value = nullptr;
+            return evalOperand(node.m_left, value) && isTruthy(*value);
+        }
+        case Node::Kind::Compare:
+        {
+            const Value* lhs = nullptr;
+            const Value* rhs = nullptr;
+            return
+                evalOperand(node.m_left, lhs) &&
+                evalOperand(node.m_right, rhs) &&
+                compareValues(*lhs, node.m_op, *rhs);
+        }
+        default: break;
+    }
+
+    [[maybe_unused]] static constexpr bool Unexpected_node = false;
+    assert(Unexpected_node);
+    return false;
+}
+
+ToolsMsgPredicate::ToolsMsgPredicate() :
+    m_state(std::make_unique<InnerState>())
+{
+}
+
+ToolsMsgPredicate::ToolsMsgPredicate(const ToolsMsgPredicate& other) :
+    m_state(std::make_unique<InnerState>())
+{
+    *this = other;
+}
+
+ToolsMsgPredicate::ToolsMsgPredicate(ToolsMsgPredicate&& other) noexcept = default;
+
+ToolsMsgPredicate::~ToolsMsgPredicate() noexcept = default;
+
+ToolsMsgPredicate& ToolsMsgPredicate::operator=(const ToolsMsgPredicate& other)
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    // The evaluation context is not copied
+    m_state->m_expr = other.m_state->m_expr;
+    m_state->m_error = other.m_state->m_error;
+    m_state->m_nodes = other.m_state->m_nodes;
+    m_state->m_paths = other.m_state->m_paths;
+    m_state->m_root = other.m_state->m_root;
+    m_state->m_pathValues.resize(m_state->m_paths.size());
+    m_state->m_pathValuesReady.resize(m_state->m_paths.size());
+    return *this;
+}
+
+ToolsMsgPredicate& ToolsMsgPredicate::operator=(ToolsMsgPredicate&& other) noexcept = default;
+
+bool ToolsMsgPredicate::compile(const QString& expr)
+{
+    auto& state = *m_state;
+    state = InnerState();
+    state.m_expr = expr;
+
+    TokensList tokens;
+    if (!tokenize(expr, tokens, state.m_error)) {
+        return false;
+    }
+
+    if (tokens.size() <= 1U) {
+        // Empty expression
+        return true;
+    }
+
+    Parser parser(tokens, state.m_nodes, state.m_paths);
+    state.m_root = parser.parse();
+    if (state.m_root < 0) {
+        state.m_error = parser.error();
+        state.m_nodes.clear();
+        state.m_paths.clear();
+        return false;
+    }
+
+    state.m_pathValues.resize(state.m_paths.size());
+    state.m_pathValuesReady.resize(state.m_paths.size());
+    return true;
+}
+
+const QString& ToolsMsgPredicate::expression() const
+{
+    return m_state->m_expr;
+}
+
+const QString& ToolsMsgPredicate::errorString() const
+{
+    return m_state->m_error;
+}
+
+bool ToolsMsgPredicate::isEmpty() const
+{
+    return m_state->m_root < 0;
+}
+
+bool ToolsMsgPredicate::matches(ToolsMessage& msg)
+{
+    auto& state = *m_state;
+    if (state.m_root < 0) {
+        return true;
+    }
+
+    state.m_msg = &msg;
+    state.m_fieldsRetrieved = false;
+    std::fill(state.m_pathValuesReady.begin(), state.m_pathValuesReady.end(), false);
+    auto result = state.evalNode(state.m_root);
+    state.m_fields.clear();
+    state.m_msg = nullptr;
+    return result;
+}
+
+}  // namespace cc_tools_qt
@@ -39,11 +39,31 @@ void ToolsMsgSendMgr::setSendCompeteCallbackFunc(SendCompleteCallbackFunc&& func
     m_impl->setSendCompleteCallbackFunc(std::move(func));
 }
 
+void ToolsMsgSendMgr::setLoadStatsReportCallbackFunc(LoadStatsReportCallbackFunc&& func)
+{
+    m_impl->setLoadStatsReportCallbackFunc(std::move(func));
+}
+
+void ToolsMsgSendMgr::setReplayStatsReportCallbackFunc(ReplayStatsReportCallbackFunc&& func)
+{
+    m_impl->setReplayStatsReportCallbackFunc(std::move(func));
+}
+
 void ToolsMsgSendMgr::start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs)
 {
     m_impl->start(std::move(protocol), msgs);
 }
 
+void ToolsMsgSendMgr::startLoad(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const LoadConfig& config)
+{
+    m_impl->startLoad(std::move(protocol), msgs, config);
+}
+
+void ToolsMsgSendMgr::startReplay(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const ReplayConfig& config)
+{
+    m_impl->startReplay(std::move(protocol), msgs, config);
+}
+
 void ToolsMsgSendMgr::stop()
 {
     m_impl->stop();
@@ -17,6 +17,7 @@
 
 #include "ToolsMsgSendMgrImpl.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "cc_tools_qt/property/message.h"
@@ -24,12 +25,45 @@
 namespace cc_tools_qt
 {
 
+namespace
+{
+
+// Limit the amount of messages sent in a single event loop iteration to
+// keep the application responsive when the target rate is high.
+const unsigned MaxMsgsPerTick = 1000U;
+const unsigned long long StatsReportPeriodMs = 500U;
+
+// The clones don't inherit the cached encoded data, share it explicitly
+// for the repeated sends of the same contents.
+void shareEncodedData(const ToolsMessage& from, ToolsMessage& to)
+{
+    if (property::message::ToolsMsgEncodedData().getFrom(from)) {
+        property::message::ToolsMsgEncodedData().copyFromTo(from, to);
+    }
+}
+
+} // namespace
+
 ToolsMsgSendMgrImpl::ToolsMsgSendMgrImpl()
-  : m_timer(this)
+  : m_timer(this),
+    m_loadTimer(this),
+    m_replayTimer(this)
 {
     connect(
         &m_timer, &QTimer::timeout,
         this, &ToolsMsgSendMgrImpl::sendPendingAndWait);
+
+    m_loadTimer.setTimerType(Qt::PreciseTimer);
+    m_loadTimer.setInterval(1);
+    connect(
+        &m_loadTimer, &QTimer::timeout,
+        this, &ToolsMsgSendMgrImpl::sendLoadTick);
+
+    m_replayTimer.setTimerType(Qt::PreciseTimer);
+    m_replayTimer.setSingleShot(true);
+    connect(
+        &m_replayTimer, &QTimer::timeout,
+        this, &ToolsMsgSendMgrImpl::sendReplayTick);
 }
 
 ToolsMsgSendMgrImpl::~ToolsMsgSendMgrImpl() noexcept = default;
@@ -54,16 +88,113 @@ void ToolsMsgSendMgrImpl::start(ToolsProtocolPtr protocol, const ToolsMessagesLi
             assert(!property::message::ToolsMsgExtraInfo().getFrom(*clonedMsg).isEmpty());
         }
 
+        if (0U < property::message::ToolsMsgRepeatDuration().getFrom(*clonedMsg)) {
+            // Repeated message is encoded only once, all the following
+            // repetitions reuse the cached data.
+            m_protocol->cacheEncodedData(*clonedMsg);
+        }
+
         m_msgsToSend.push_back(std::move(clonedMsg));
     }
     sendPendingAndWait();
 }
 
+void ToolsMsgSendMgrImpl::startLoad(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const LoadConfig& config)
+{
+    [[maybe_unused]] static constexpr bool The_previous_sending_must_be_stopped_first = false;
+    assert((m_msgsToSend.empty() && m_load.m_msgs.empty() && m_replay.m_msgs.empty()) || The_previous_sending_must_be_stopped_first);
+    m_protocol = std::move(protocol);
+    m_load = LoadState();
+    m_load.m_config = config;
+    m_load.m_config.m_burstSize = std::max(m_load.m_config.m_burstSize, 1U);
+
+    unsigned long long totalSize = 0U;
+    for (auto& m : msgs) {
+        auto clonedMsg = m_protocol->cloneMessage(*m);
+        auto extraProps = property::message::ToolsMsgExtraInfo().getFrom(*m);
+        if (!extraProps.isEmpty()) {
+            property::message::ToolsMsgExtraInfo().setTo(std::move(extraProps), *clonedMsg);
+            m_protocol->updateMessage(*clonedMsg);
+        }
+
+        // Every message is encoded only once, all the sends reuse the cached data.
+        m_protocol->cacheEncodedData(*clonedMsg);
+
+        std::size_t msgSize = 0U;
+        auto encodedData = property::message::ToolsMsgEncodedData().getFrom(*clonedMsg);
+        if (encodedData) {
+            msgSize = encodedData->m_data.size();
+        }
+
+        totalSize += msgSize;
+        m_load.m_msgSizes.push_back(msgSize);
+        m_load.m_msgs.push_back(std::move(clonedMsg));
+    }
+
+    if (m_load.m_msgs.empty()) {
+        if (m_sendCompleteCallback) {
+            m_sendCompleteCallback();
+        }
+        return;
+    }
+
+    m_load.m_avgMsgSize = std::max(totalSize / m_load.m_msgs.size(), 1ULL);
+    m_loadElapsed.start();
+    m_loadTimer.start();
+    sendLoadTick();
+}
+
+void ToolsMsgSendMgrImpl::startReplay(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const ReplayConfig& config)
+{
+    [[maybe_unused]] static constexpr bool The_previous_sending_must_be_stopped_first = false;
+    assert((m_msgsToSend.empty() && m_load.m_msgs.empty() && m_replay.m_msgs.empty()) || The_previous_sending_must_be_stopped_first);
+    m_protocol = std::move(protocol);
+    m_replay = ReplayState();
+    m_replay.m_config = config;
+    m_replay.m_config.m_speed = std::max(m_replay.m_config.m_speed, 0.0);
+
+    unsigned long long sendTimeMs = 0U;
+    for (auto& m : msgs) {
+        auto clonedMsg = m_protocol->cloneMessage(*m);
+        property::message::ToolsMsgComment().copyFromTo(*m, *clonedMsg);
+        auto extraProps = property::message::ToolsMsgExtraInfo().getFrom(*m);
+        if (!extraProps.isEmpty()) {
+            property::message::ToolsMsgExtraInfo().setTo(std::move(extraProps), *clonedMsg);
+            m_protocol->updateMessage(*clonedMsg);
+        }
+
+        sendTimeMs += property::message::ToolsMsgDelay().getFrom(*m);
+
+        unsigned long long sendTimeUs = 0U;
+        if (0.0 < m_replay.m_config.m_speed) {
+            sendTimeUs = static_cast<decltype(sendTimeUs)>((static_cast<double>(sendTimeMs) * 1000.0) / m_replay.m_config.m_speed);
+        }
+
+        m_replay.m_sendTimesUs.push_back(sendTimeUs);
+        m_replay.m_msgs.push_back(std::move(clonedMsg));
+    }
+
+    m_replay.m_stats.m_totalMsgs = m_replay.m_msgs.size();
+    if (m_replay.m_msgs.empty()) {
+        if (m_sendCompleteCallback) {
+            m_sendCompleteCallback();
+        }
+        return;
+    }
+
+    m_replayElapsed.start();
+    sendReplayTick();
+}
+
 void ToolsMsgSendMgrImpl::stop()
 {
     m_timer.stop();
+    m_loadTimer.stop();
+    m_replayTimer.stop();
     m_protocol.reset();
     m_msgsToSend.clear();
+    m_load = LoadState();
+    m_replay = ReplayState();
 }
 
 void ToolsMsgSendMgrImpl::sendPendingAndWait()
@@ -127,6 +258,9 @@ void ToolsMsgSendMgrImpl::sendPendingAndWait()
                 m_protocol->updateMessage(*clonedMsg);
             }
 
+            // The extra info is the same as well, the encoded data is still valid
+            shareEncodedData(*msgToSend, *clonedMsg);
+
             std::swap(clonedMsg, msgToSend);
             property::message::ToolsMsgDelay().setTo(newDelay, *clonedMsg);
 
@@ -156,4 +290,201 @@ void ToolsMsgSendMgrImpl::sendPendingAndWait()
         m_sendCompleteCallback();
     }
 }
+
+void ToolsMsgSendMgrImpl::sendLoadTick()
+{
+    if ((!m_protocol) || m_load.m_msgs.empty()) {
+        m_loadTimer.stop();
+        return;
+    }
+
+    auto elapsedMs = static_cast<unsigned long long>(m_loadElapsed.elapsed());
+    auto& config = m_load.m_config;
+    if ((0U < config.m_durationMs) && (config.m_durationMs <= elapsedMs)) {
+        finishLoad();
+        return;
+    }
+
+    auto& stats = m_load.m_stats;
+    ToolsMessagesList msgsToSend;
+    unsigned count = 0U;
+    while ((count < MaxMsgsPerTick) && isLoadBurstDue(elapsedMs)) {
+        for (auto idx = 0U; idx < config.m_burstSize; ++idx) {
+            assert(m_load.m_nextIdx < m_load.m_msgs.size());
+            auto& msg = m_load.m_msgs[m_load.m_nextIdx];
+            assert(msg);
+            auto clonedMsg = m_protocol->cloneMessage(*msg);
+            if (clonedMsg) {
+                shareEncodedData(*msg, *clonedMsg);
+            }
+
+            msgsToSend.push_back(std::move(clonedMsg));
+            ++stats.m_sentMsgs;
+            stats.m_sentBytes += m_load.m_msgSizes[m_load.m_nextIdx];
+            m_load.m_nextIdx = (m_load.m_nextIdx + 1U) % m_load.m_msgs.size();
+        }
+
+        count += config.m_burstSize;
+    }
+
+    if ((!msgsToSend.empty()) && m_sendCallback) {
+        m_sendCallback(std::move(msgsToSend));
+    }
+
+    if (StatsReportPeriodMs <= (elapsedMs - m_load.m_lastReportMs)) {
+        reportLoadStats(elapsedMs);
+    }
+}
+
+bool ToolsMsgSendMgrImpl::isLoadBurstDue(unsigned long long elapsedMs) const
+{
+    auto& config = m_load.m_config;
+    if (config.m_rate == 0U) {
+        return true;
+    }
+
+    auto& stats = m_load.m_stats;
+    if (config.m_rateUnits == LoadConfig::RateUnits::Bytes) {
+        return (stats.m_sentBytes * 1000U) <= (config.m_rate * elapsedMs);
+    }
+
+    return (stats.m_sentMsgs * 1000U) <= (config.m_rate * elapsedMs);
+}
+
+unsigned long long ToolsMsgSendMgrImpl::loadQueueDepth(unsigned long long elapsedMs) const
+{
+    auto& config = m_load.m_config;
+    if (config.m_rate == 0U) {
+        return 0U;
+    }
+
+    auto& stats = m_load.m_stats;
+    auto due = (config.m_rate * elapsedMs) / 1000U;
+    if (config.m_rateUnits == LoadConfig::RateUnits::Bytes) {
+        if (due <= stats.m_sentBytes) {
+            return 0U;
+        }
+
+        assert(0U < m_load.m_avgMsgSize);
+        return (due - stats.m_sentBytes) / m_load.m_avgMsgSize;
+    }
+
+    if (due <= stats.m_sentMsgs) {
+        return 0U;
+    }
+
+    return due - stats.m_sentMsgs;
+}
+
+void ToolsMsgSendMgrImpl::reportLoadStats(unsigned long long elapsedMs)
+{
+    auto& stats = m_load.m_stats;
+    stats.m_elapsedMs = elapsedMs;
+    stats.m_queueDepth = loadQueueDepth(elapsedMs);
+
+    auto intervalMs = elapsedMs - m_load.m_lastReportMs;
+    if (0U < intervalMs) {
+        stats.m_msgsRate = static_cast<double>(stats.m_sentMsgs - m_load.m_lastReportMsgs) * 1000.0 / static_cast<double>(intervalMs);
+        stats.m_bytesRate = static_cast<double>(stats.m_sentBytes - m_load.m_lastReportBytes) * 1000.0 / static_cast<double>(intervalMs);
+    }
+
+    m_load.m_lastReportMs = elapsedMs;
+    m_load.m_lastReportMsgs = stats.m_sentMsgs;
+    m_load.m_lastReportBytes = stats.m_sentBytes;
+
+    if (m_loadStatsReportCallback) {
+        m_loadStatsReportCallback(stats);
+    }
+}
+
+void ToolsMsgSendMgrImpl::finishLoad()
+{
+    m_loadTimer.stop();
+    auto elapsedMs = static_cast<unsigned long long>(m_loadElapsed.elapsed());
+    if (0U < m_load.m_config.m_durationMs) {
+        elapsedMs = std::min(elapsedMs, m_load.m_config.m_durationMs);
+    }
+
+    reportLoadStats(elapsedMs);
+    m_load = LoadState();
+
+    if (m_sendCompleteCallback) {
+        m_sendCompleteCallback();
+    }
+}
+
+void ToolsMsgSendMgrImpl::sendReplayTick()
+{
+    if ((!m_protocol) || m_replay.m_msgs.empty()) {
+        return;
+    }
+
+    auto& stats = m_replay.m_stats;
+    auto nowUs = static_cast<unsigned long long>(m_replayElapsed.nsecsElapsed() / 1000);
+    bool maxSpeed = (m_replay.m_config.m_speed <= 0.0);
+    ToolsMessagesList msgsToSend;
+    while ((m_replay.m_nextIdx < m_replay.m_msgs.size()) && (msgsToSend.size() < MaxMsgsPerTick)) {
+        auto sendTimeUs = m_replay.m_sendTimesUs[m_replay.m_nextIdx];
+        if (nowUs < sendTimeUs) {
+            break;
+        }
+
+        if (!maxSpeed) {
+            stats.m_lagMs = (nowUs - sendTimeUs) / 1000U;
+            stats.m_maxLagMs = std::max(stats.m_maxLagMs, stats.m_lagMs);
+        }
+
+        msgsToSend.push_back(std::move(m_replay.m_msgs[m_replay.m_nextIdx]));
+        ++m_replay.m_nextIdx;
+    }
+
+    stats.m_sentMsgs += msgsToSend.size();
+    if ((!msgsToSend.empty()) && m_sendCallback) {
+        m_sendCallback(std::move(msgsToSend));
+    }
+
+    auto elapsedMs = static_cast<unsigned long long>(m_replayElapsed.elapsed());
+    if (m_replay.m_msgs.size() <= m_replay.m_nextIdx) {
+        finishReplay();
+        return;
+    }
+
+    if (StatsReportPeriodMs <= (elapsedMs - m_replay.m_lastReportMs)) {
+        reportReplayStats(elapsedMs);
+    }
+
+    // Schedule against the absolute time since the replay start rather than
+    // relative to the previous send to prevent accumulation of the drift.
+    nowUs = static_cast<unsigned long long>(m_replayElapsed.nsecsElapsed() / 1000);
+    auto nextSendTimeUs = m_replay.m_sendTimesUs[m_replay.m_nextIdx];
+    int waitMs = 0;
+    if (nowUs < nextSendTimeUs) {
+        waitMs = static_cast<int>((nextSendTimeUs - nowUs + 999U) / 1000U);
+    }
+
+    m_replayTimer.start(waitMs);
+}
+
+void ToolsMsgSendMgrImpl::reportReplayStats(unsigned long long elapsedMs)
+{
+    auto& stats = m_replay.m_stats;
+    stats.m_elapsedMs = elapsedMs;
+    m_replay.m_lastReportMs = elapsedMs;
+
+    if (m_replayStatsReportCallback) {
+        m_replayStatsReportCallback(stats);
+    }
+}
+
+void ToolsMsgSendMgrImpl::finishReplay()
+{
+    m_replayTimer.stop();
+    reportReplayStats(static_cast<unsigned long long>(m_replayElapsed.elapsed()));
+    m_replay = ReplayState();
+
+    if (m_sendCompleteCallback) {
+        m_sendCompleteCallback();
+    }
+}
+
 }  // namespace cc_tools_qt
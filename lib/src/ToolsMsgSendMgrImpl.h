@@ -21,9 +21,11 @@
 #include "cc_tools_qt/ToolsProtocol.h"
 
 #include <QtCore/QObject>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QTimer>
 
 #include <memory>
+#include <vector>
 
 namespace cc_tools_qt
 {
@@ -34,6 +36,12 @@ class ToolsMsgSendMgrImpl : public QObject
 public:
     using SendMsgsCallbackFunc = ToolsMsgSendMgr::SendMsgsCallbackFunc;
     using SendCompleteCallbackFunc = ToolsMsgSendMgr::SendCompleteCallbackFunc;
+    using LoadStatsReportCallbackFunc = ToolsMsgSendMgr::LoadStatsReportCallbackFunc;
+    using LoadConfig = ToolsMsgSendMgr::LoadConfig;
+    using LoadStats = ToolsMsgSendMgr::LoadStats;
+    using ReplayStatsReportCallbackFunc = ToolsMsgSendMgr::ReplayStatsReportCallbackFunc;
+    using ReplayConfig = ToolsMsgSendMgr::ReplayConfig;
+    using ReplayStats = ToolsMsgSendMgr::ReplayStats;
 
     ToolsMsgSendMgrImpl();
     ~ToolsMsgSendMgrImpl() noexcept;
@@ -50,19 +58,73 @@ public:
         m_sendCompleteCallback = std::forward<TFunc>(func);
     }
 
+    template <typename TFunc>
+    void setLoadStatsReportCallbackFunc(TFunc&& func)
+    {
+        m_loadStatsReportCallback = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setReplayStatsReportCallbackFunc(TFunc&& func)
+    {
+        m_replayStatsReportCallback = std::forward<TFunc>(func);
+    }
+
     void start(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs);
+    void startLoad(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const LoadConfig& config);
+    void startReplay(ToolsProtocolPtr protocol, const ToolsMessagesList& msgs, const ReplayConfig& config);
 
     void stop();
 
 private slots:
     void sendPendingAndWait();
+    void sendLoadTick();
+    void sendReplayTick();
 
 private:
+    struct LoadState
+    {
+        std::vector<ToolsMessagePtr> m_msgs;
+        std::vector<std::size_t> m_msgSizes;
+        std::size_t m_nextIdx = 0U;
+        LoadConfig m_config;
+        LoadStats m_stats;
+        unsigned long long m_avgMsgSize = 0U;
+        unsigned long long m_lastReportMs = 0U;
+        unsigned long long m_lastReportMsgs = 0U;
+        unsigned long long m_lastReportBytes = 0U;
+    };
+
+    struct ReplayState
+    {
+        std::vector<ToolsMessagePtr> m_msgs;
+        std::vector<unsigned long long> m_sendTimesUs;
+        std::size_t m_nextIdx = 0U;
+        ReplayConfig m_config;
+        ReplayStats m_stats;
+        unsigned long long m_lastReportMs = 0U;
+    };
+
+    bool isLoadBurstDue(unsigned long long elapsedMs) const;
+    unsigned long long loadQueueDepth(unsigned long long elapsedMs) const;
+    void reportLoadStats(unsigned long long elapsedMs);
+    void finishLoad();
+    void reportReplayStats(unsigned long long elapsedMs);
+    void finishReplay();
+
     SendMsgsCallbackFunc m_sendCallback;
     SendCompleteCallbackFunc m_sendCompleteCallback;
+    LoadStatsReportCallbackFunc m_loadStatsReportCallback;
+    ReplayStatsReportCallbackFunc m_replayStatsReportCallback;
     ToolsProtocolPtr m_protocol;
     ToolsMessagesList m_msgsToSend;
     QTimer m_timer;
+    QTimer m_loadTimer;
+    QElapsedTimer m_loadElapsed;
+    LoadState m_load;
+    QTimer m_replayTimer;
+    QElapsedTimer m_replayElapsed;
+    ReplayState m_replay;
 };
 
 }  // namespace cc_tools_qt
@@ -0,0 +1,195 @@
+//
+// Copyright 2025 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "cc_tools_qt/ToolsMsgStats.h"
+
+#include "cc_tools_qt/ToolsDataInfo.h"
+#include "cc_tools_qt/property/message.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cc_tools_qt
+{
+
+namespace
+{
+
+const unsigned MsInSec = 1000U;
+
+// The current (incomplete) second is not part of the rate windows
+const std::size_t BucketsCount = 64U;
+
+const unsigned long long WindowSecs[ToolsMsgStats::RateWindow_NumOfValues] = {
+    /* RateWindow_1s */ 1U,
+    /* RateWindow_10s */ 10U,
+    /* RateWindow_60s */ 60U,
+};
+
+static_assert(WindowSecs[ToolsMsgStats::RateWindow_60s] < BucketsCount, "Not enough buckets");
+
+// Number of messages within the specific second
+struct Bucket
+{
+    unsigned long long m_sec = 0U;
+    unsigned long long m_count = 0U;
+};
+
+using Buckets = std::array<Bucket, BucketsCount>;
+
+}  // namespace
+
+struct ToolsMsgStats::InnerState
+{
+    using Key = std::tuple<int, qlonglong, unsigned>;
+
+    std::vector<Entry> m_entries;
+    std::vector<Buckets> m_buckets;
+    std::map<Key, std::size_t> m_entriesMap;
+    unsigned long long m_garbageCount = 0U;
+    unsigned long long m_garbageBytes = 0U;
+    unsigned long long m_updatesCount = 0U;
+};
+
+ToolsMsgStats::ToolsMsgStats() :
+    m_state(std::make_unique<InnerState>())
+{
+}
+
+ToolsMsgStats::~ToolsMsgStats() noexcept = default;
+
+void ToolsMsgStats::addMsg(const ToolsMessage& msg, std::size_t bytes)
+{
+    auto& s = *m_state;
+    ++s.m_updatesCount;
+
+    if (msg.idAsString().isEmpty()) {
+        ++s.m_garbageCount;
+        s.m_garbageBytes += bytes;
+        return;
+    }
+
+    auto type = property::message::ToolsMsgType().getFrom(msg);
+    auto id = msg.numericId();
+    auto idx = property::message::ToolsMsgIdx().getFrom(msg);
+    auto key = InnerState::Key(static_cast<int>(type), id, idx);
+
+    // The number of distinct messages is small and fixed by the protocol,
+    // the lookup doesn't depend on the amount of traffic.
+    auto iter = s.m_entriesMap.find(key);
+    if (iter == s.m_entriesMap.end()) {
+        iter = s.m_entriesMap.insert(std::make_pair(key, s.m_entries.size())).first;
+
+        Entry newEntry;
+        newEntry.m_name = msg.name();
+        newEntry.m_id = id;
+        newEntry.m_idx = idx;
+        newEntry.m_type = type;
+        s.m_entries.push_back(std::move(newEntry));
+        s.m_buckets.emplace_back();
+    }
+
+    auto entryIdx = iter->second;
+    assert(entryIdx < s.m_entries.size());
+    auto& entry = s.m_entries[entryIdx];
+    auto timestamp = property::message::ToolsMsgTimestamp().getFrom(msg);
+    ++entry.m_count;
+    entry.m_bytes += bytes;
+    entry.m_lastSeen = std::max(entry.m_lastSeen, timestamp);
+    if (!msg.isValid()) {
+        ++entry.m_invalidCount;
+    }
+
+    auto sec = timestamp / MsInSec;
+    auto& bucket = s.m_buckets[entryIdx][static_cast<std::size_t>(sec % BucketsCount)];
+    if (bucket.m_sec != sec) {
+        if (sec < bucket.m_sec) {
+            // Too old to be accounted in the rate
+            return;
+        }
+
+        bucket.m_sec = sec;
+        bucket.m_count = 0U;
+    }
+
+    ++bucket.m_count;
+}
+
+void ToolsMsgStats::clear()
+{
+    auto updatesCount = m_state->m_updatesCount;
+    *m_state = InnerState();
+    m_state->m_updatesCount = updatesCount + 1U;
+}
+
+std::size_t ToolsMsgStats::entriesCount() const
+{
+    return m_state->m_entries.size();
+}
+
+const ToolsMsgStats::Entry& ToolsMsgStats::entry(std::size_t idx) const
+{
+    assert(idx < m_state->m_entries.size());
+    return m_state->m_entries[idx];
+}
+
+double ToolsMsgStats::rate(std::size_t idx, RateWindow window, TimestampType now) const
+{
+    assert(idx < m_state->m_buckets.size());
+    assert(window < RateWindow_NumOfValues);
+    auto windowSecs = WindowSecs[window];
+    auto nowSec = now / MsInSec;
+    unsigned long long count = 0U;
+    for (auto& bucket : m_state->m_buckets[idx]) {
+        if ((bucket.m_count == 0U) || (nowSec <= bucket.m_sec) || (windowSecs < (nowSec - bucket.m_sec))) {
+            continue;
+        }
+
+        count += bucket.m_count;
+    }
+
+    return static_cast<double>(count) / static_cast<double>(windowSecs);
+}
+
+unsigned long long ToolsMsgStats::garbageCount() const
+{
+    return m_state->m_garbageCount;
+}
+
+unsigned long long ToolsMsgStats::garbageBytes() const
+{
+    return m_state->m_garbageBytes;
+}
+
+unsigned long long ToolsMsgStats::updatesCount() const
+{
+    return m_state->m_updatesCount;
+}
+
+ToolsMsgStats::TimestampType ToolsMsgStats::now()
+{
+    auto sinceEpoch = ToolsDataInfo::TimestampClock::now().time_since_epoch();
+    return static_cast<TimestampType>(std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count());
+}
+
+}  // namespace cc_tools_qt
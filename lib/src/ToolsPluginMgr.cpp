@@ -54,6 +54,11 @@ void ToolsPluginMgr::setPluginsDir(const QString& pluginDir)
     m_impl->setPluginsDir(pluginDir);
 }
 
+void ToolsPluginMgr::setCacheFile(const QString& filename)
+{
+    m_impl->setCacheFile(filename);
+}
+
 const ToolsPluginMgr::ListOfPluginInfos& ToolsPluginMgr::getAvailablePlugins()
 {
     return m_impl->getAvailablePlugins();
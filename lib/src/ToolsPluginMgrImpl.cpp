@@ -24,7 +24,9 @@
 
 #include <QtCore/QString>
 #include <QtCore/QVariantList>
+#include <QtCore/QDateTime>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QJsonArray>
 #include <QtCore/QVariantList>
 
@@ -42,6 +44,11 @@ const QString MetaDataMetaKey("MetaData");
 const QString NameMetaKey("name");
 const QString DescMetaKey("desc");
 const QString TypeMetaKey("type");
+const QString CacheVersionKey("version");
+const QString CachePluginsKey("plugins");
+const QString CacheMtimeKey("mtime");
+const QString CacheSizeKey("size");
+const unsigned CacheVersion = 1U;
 
 struct PluginLoaderDeleter
 {
@@ -119,6 +126,13 @@ void ToolsPluginMgrImpl::setPluginsDir(const QString& pluginDir)
     m_pluginDir = pluginDir;
 }
 
+void ToolsPluginMgrImpl::setCacheFile(const QString& filename)
+{
+    m_cacheFile = filename;
+    m_cache.clear();
+    m_cacheLoaded = false;
+}
+
 const ToolsPluginMgrImpl::ListOfPluginInfos& ToolsPluginMgrImpl::getAvailablePlugins()
 {
     if (!m_plugins.empty()) {
@@ -130,8 +144,19 @@ const ToolsPluginMgrImpl::ListOfPluginInfos& ToolsPluginMgrImpl::getAvailablePlu
         auto files =
             pluginDir.entryList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
 
+        loadCache();
+        QVariantMap updatedCache;
+        bool cacheModified = false;
         for (auto& f : files) {
-            auto infoPtr = readPluginInfo(f);
+            QFileInfo fileInfo(pluginDir.absoluteFilePath(f));
+            PluginInfoPtr infoPtr;
+            if (!readCachedPluginInfo(f, fileInfo, infoPtr)) {
+                infoPtr = readPluginInfo(f);
+                cacheModified = true;
+            }
+
+            // The libraries which are not plugins are cached as well
+            updatedCache.insert(fileInfo.absoluteFilePath(), createCacheEntry(infoPtr.get(), fileInfo));
             if (!infoPtr) {
                 continue;
             }
@@ -144,6 +169,11 @@ const ToolsPluginMgrImpl::ListOfPluginInfos& ToolsPluginMgrImpl::getAvailablePlu
 
             m_plugins.push_back(std::move(infoPtr));
         }
+
+        if (cacheModified || (updatedCache.size() != m_cache.size())) {
+            m_cache = std::move(updatedCache);
+            saveCache();
+        }
     } while (false);
 
     m_plugins.sort(
@@ -198,9 +228,16 @@ ToolsPluginMgrImpl::ListOfPluginInfos ToolsPluginMgrImpl::loadPluginsFromConfig(
             auto pluginInfoPtr = *iter;
             assert(pluginInfoPtr);
             assert(pluginInfoPtr->m_loader);
-            auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
-            assert(pluginPtr != nullptr);
-            pluginPtr->reconfigure(config);
+            if (!pluginInfoPtr->m_loader->isLoaded()) {
+                // Instantiated and configured when actually used
+                m_pendingConfigs.insert(pluginInfoPtr->m_iid, config);
+            }
+            else {
+                auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+                assert(pluginPtr != nullptr);
+                pluginPtr->reconfigure(config);
+                m_pendingConfigs.remove(pluginInfoPtr->m_iid);
+            }
 
             pluginInfos.push_back(*iter);
         }
@@ -231,7 +268,7 @@ bool ToolsPluginMgrImpl::savePluginsToConfigFile(
 
 ToolsPlugin* ToolsPluginMgrImpl::loadPlugin(const PluginInfo& info)
 {
-    return getPlugin(*info.m_loader);
+    return instantiatePlugin(info);
 }
 
 bool ToolsPluginMgrImpl::hasAppliedPlugins() const
@@ -315,8 +352,7 @@ QVariantMap ToolsPluginMgrImpl::getConfigForPlugins(
         assert(!pluginInfoPtr->m_iid.isEmpty());
         pluginsList.append(QVariant::fromValue(pluginInfoPtr->m_iid));
 
-        assert(pluginInfoPtr->m_loader);
-        auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+        auto* pluginPtr = instantiatePlugin(*pluginInfoPtr);
         assert(pluginPtr != nullptr);
         pluginPtr->getCurrentConfig(config);
     }
@@ -399,6 +435,111 @@ ToolsPluginMgrImpl::PluginInfoPtr ToolsPluginMgrImpl::readPluginInfo(const QStri
     return ptr;
 }
 
+ToolsPlugin* ToolsPluginMgrImpl::instantiatePlugin(const PluginInfo& info)
+{
+    assert(info.m_loader);
+    auto* plugin = getPlugin(*info.m_loader);
+    if (plugin == nullptr) {
+        return plugin;
+    }
+
+    auto iter = m_pendingConfigs.find(info.m_iid);
+    if (iter != m_pendingConfigs.end()) {
+        plugin->reconfigure(iter.value());
+        m_pendingConfigs.erase(iter);
+    }
+
+    return plugin;
+}
+
+bool ToolsPluginMgrImpl::readCachedPluginInfo(
+    const QString& filename,
+    const QFileInfo& fileInfo,
+    PluginInfoPtr& ptr) const
+{
+    auto entryVar = m_cache.value(fileInfo.absoluteFilePath());
+    if ((!entryVar.isValid()) || (!entryVar.canConvert<QVariantMap>())) {
+        return false;
+    }
+
+    auto entry = entryVar.toMap();
+    if ((entry.value(CacheMtimeKey).toLongLong() != fileInfo.lastModified().toMSecsSinceEpoch()) ||
+        (entry.value(CacheSizeKey).toLongLong() != fileInfo.size())) {
+        return false;
+    }
+
+    auto iid = entry.value(IidMetaKey).toString();
+    if (iid.isEmpty()) {
+        ptr.reset();
+        return true;
+    }
+
+    auto type = entry.value(TypeMetaKey).toUInt();
+    if (static_cast<unsigned>(PluginInfo::Type::NumOfValues) <= type) {
+        return false;
+    }
+
+    // The library itself is not accessed until the plugin is instantiated
+    ptr.reset(new PluginInfo());
+    ptr->m_loader.reset(new QPluginLoader(filename));
+    ptr->m_iid = iid;
+    ptr->m_name = entry.value(NameMetaKey).toString();
+    ptr->m_desc = entry.value(DescMetaKey).toString();
+    ptr->m_type = static_cast<PluginInfo::Type>(type);
+    return true;
+}
+
+QVariantMap ToolsPluginMgrImpl::createCacheEntry(const PluginInfo* info, const QFileInfo& fileInfo)
+{
+    QVariantMap entry;
+    entry.insert(CacheMtimeKey, fileInfo.lastModified().toMSecsSinceEpoch());
+    entry.insert(CacheSizeKey, fileInfo.size());
+    if (info == nullptr) {
+        return entry;
+    }
+
+    entry.insert(IidMetaKey, info->m_iid);
+    entry.insert(NameMetaKey, info->m_name);
+    entry.insert(DescMetaKey, info->m_desc);
+    entry.insert(TypeMetaKey, static_cast<unsigned>(info->m_type));
+    return entry;
+}
+
+void ToolsPluginMgrImpl::loadCache()
+{
+    if (m_cacheLoaded || m_cacheFile.isEmpty()) {
+        return;
+    }
+
+    m_cacheLoaded = true;
+    if (!QFile::exists(m_cacheFile)) {
+        return;
+    }
+
+    auto config = m_configMgr.loadConfig(m_cacheFile, false);
+    if (config.value(CacheVersionKey).toUInt() != CacheVersion) {
+        return;
+    }
+
+    m_cache = config.value(CachePluginsKey).toMap();
+}
+
+void ToolsPluginMgrImpl::saveCache()
+{
+    if (m_cacheFile.isEmpty()) {
+        return;
+    }
+
+    QFileInfo(m_cacheFile).absoluteDir().mkpath(".");
+
+    QVariantMap config;
+    config.insert(CacheVersionKey, CacheVersion);
+    config.insert(CachePluginsKey, m_cache);
+    if (!m_configMgr.saveConfig(m_cacheFile, config, false)) {
+        std::cerr << "WARNING: Failed to save plugins cache to " << m_cacheFile.toStdString() << std::endl;
+    }
+}
+
 }  // namespace cc_tools_qt
 
 
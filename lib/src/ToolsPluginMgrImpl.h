@@ -22,6 +22,8 @@
 #include <list>
 #include <array>
 
+#include <QtCore/QFileInfo>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 #include <QtCore/QVariantMap>
@@ -48,6 +50,7 @@ public:
     ~ToolsPluginMgrImpl() noexcept;
 
     void setPluginsDir(const QString& pluginDir);
+    void setCacheFile(const QString& filename);
     const ListOfPluginInfos& getAvailablePlugins();
     const ListOfPluginInfos& getAppliedPlugins() const;
     void setAppliedPlugins(const ListOfPluginInfos& plugins);
@@ -68,10 +71,21 @@ private:
     using PluginLoadersList = std::list<PluginLoaderPtr>;
 
     PluginInfoPtr readPluginInfo(const QString& filename);
+    ToolsPlugin* instantiatePlugin(const PluginInfo& info);
+    bool readCachedPluginInfo(const QString& filename, const QFileInfo& fileInfo, PluginInfoPtr& ptr) const;
+    static QVariantMap createCacheEntry(const PluginInfo* info, const QFileInfo& fileInfo);
+    void loadCache();
+    void saveCache();
 
     QString m_pluginDir;
+    QString m_cacheFile;
+    QVariantMap m_cache;
+    bool m_cacheLoaded = false;
     ListOfPluginInfos m_plugins;
     ListOfPluginInfos m_appliedPlugins;
+    // Configuration loaded before the plugin was instantiated, applied on
+    // its first instantiation, the key is the plugin IID.
+    QMap<QString, QVariantMap> m_pendingConfigs;
     ToolsConfigMgr m_configMgr;
 };
 
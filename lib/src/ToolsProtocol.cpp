@@ -70,6 +70,8 @@ std::string dataToStr(const ToolsDataInfo::DataSeq& data)
 struct ToolsProtocol::InnerState
 {
     ToolsFramePtr m_frame;
+    MsgCatalog m_msgCatalog;
+    bool m_msgCatalogValid = false;
     unsigned m_debugLevel = 0U;
 };
 
@@ -116,6 +118,17 @@ ToolsMessagesList ToolsProtocol::read(
     return messages;
 }
 
+ToolsMessagePtr ToolsProtocol::decodeMessage(const ToolsDataInfo& dataInfo)
+{
+    assert(m_state->m_frame);
+    auto msg = m_state->m_frame->readSingleMessage(dataInfo);
+    if (msg) {
+        setNameToMessageProperties(*msg);
+    }
+
+    return msg;
+}
+
 ToolsDataInfoPtr ToolsProtocol::write(ToolsMessage& msg)
 {
     unsigned long long milliseconds = property::message::ToolsMsgTimestamp().getFrom(msg);;
@@ -129,28 +142,24 @@ ToolsDataInfoPtr ToolsProtocol::write(ToolsMessage& msg)
         std::cout << '[' << milliseconds << "] " << msg.name() << " --> " << debugPrefix() << std::endl;
     }
 
-    if (msg.idAsString().isEmpty()) {
+    ToolsDataInfoPtr dataInfo;
+    auto cachedDataInfo = property::message::ToolsMsgEncodedData().getFrom(msg);
+    if (cachedDataInfo) {
+        dataInfo = makeDataInfo();
+        assert(dataInfo);
 
-        auto rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(msg);
-        if (!rawDataMsg) {
-            return ToolsDataInfoPtr();
-        }
-
-        auto dataInfoPtr = makeDataInfo();
-        assert(dataInfoPtr);
-
-        dataInfoPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
-        dataInfoPtr->m_data = rawDataMsg->encodeData();
-
-        return dataInfoPtr;
+        dataInfo->m_timestamp = ToolsDataInfo::TimestampClock::now();
+        dataInfo->m_data = cachedDataInfo->m_data;
+        dataInfo->m_extraProperties = cachedDataInfo->m_extraProperties;
+    }
+    else {
+        dataInfo = encodeInternal(msg);
     }
 
-    auto dataInfo = makeDataInfo();
-    assert(dataInfo);
+    if (!dataInfo) {
+        return dataInfo;
+    }
 
-    dataInfo->m_timestamp = ToolsDataInfo::TimestampClock::now();
-    dataInfo->m_data = msg.encodeFramed(*m_state->m_frame);
-    dataInfo->m_extraProperties = getExtraInfoFromMessageProperties(msg);
     if (1U <= m_state->m_debugLevel) {
         std::cout << '[' << milliseconds << "] " << debugPrefix() << " --> " << dataInfo->m_data.size() << " bytes";
         if (2U <= m_state->m_debugLevel) {
@@ -176,16 +185,63 @@ ToolsMessagesList ToolsProtocol::createAllMessages()
 
         prevId = msgPtr->idAsString();
         prevIdx = idx;
-        property::message::ToolsMsgIdx().setTo(idx, *msgPtr);
-
-        setNameToMessageProperties(*msgPtr);
-        setForceExtraInfoExistenceToMessageProperties(*msgPtr);
-        updateMessage(*msgPtr);
+        prepareCreatedMessage(*msgPtr, idx);
     }    
 
     return allMsgs;    
 }
 
+const ToolsProtocol::MsgCatalog& ToolsProtocol::msgCatalog()
+{
+    if (m_state->m_msgCatalogValid) {
+        return m_state->m_msgCatalog;
+    }
+
+    assert(m_state->m_frame);
+    auto allMsgs = m_state->m_frame->createAllMessages();
+    auto& catalog = m_state->m_msgCatalog;
+    catalog.clear();
+    catalog.reserve(allMsgs.size());
+    for (auto& msgPtr : allMsgs) {
+        assert(msgPtr);
+        MsgCatalogEntry entry;
+        entry.m_name = msgPtr->name();
+        entry.m_idAsString = msgPtr->idAsString();
+        entry.m_id = msgPtr->numericId();
+        if ((!catalog.empty()) && (catalog.back().m_idAsString == entry.m_idAsString)) {
+            entry.m_idx = catalog.back().m_idx + 1U;
+        }
+
+        catalog.push_back(std::move(entry));
+    }
+
+    m_state->m_msgCatalogValid = true;
+    return catalog;
+}
+
+ToolsMessagePtr ToolsProtocol::createCatalogMessage(std::size_t idx)
+{
+    auto& catalog = msgCatalog();
+    if (catalog.size() <= idx) {
+        return ToolsMessagePtr();
+    }
+
+    auto& entry = catalog[idx];
+    assert(m_state->m_frame);
+    auto msgPtr = m_state->m_frame->createMessage(entry.m_idAsString, entry.m_idx);
+    if (msgPtr) {
+        prepareCreatedMessage(*msgPtr, entry.m_idx);
+    }
+
+    return msgPtr;
+}
+
+void ToolsProtocol::invalidateMsgCatalog()
+{
+    m_state->m_msgCatalog.clear();
+    m_state->m_msgCatalogValid = false;
+}
+
 ToolsMessagePtr ToolsProtocol::createMessage(const QString& idAsString, unsigned idx)
 {
     assert(m_state->m_frame);
@@ -198,6 +254,10 @@ ToolsMessagePtr ToolsProtocol::createMessage(const QString& idAsString, unsigned
 
 ToolsProtocol::UpdateStatus ToolsProtocol::updateMessage(ToolsMessage& msg)
 {
+    if (property::message::ToolsMsgEncodedData().getFrom(msg)) {
+        property::message::ToolsMsgEncodedData().setTo(ToolsDataInfoPtr(), msg);
+    }
+
     if (!msg.idAsString().isEmpty()) {
         bool refreshed = msg.refreshMsg();
         assert(m_state->m_frame);
@@ -219,27 +279,34 @@ ToolsProtocol::UpdateStatus ToolsProtocol::updateMessage(ToolsMessage& msg)
         return UpdateStatus::NoChange;
     }
 
-    assert(m_state->m_frame);
-    auto infoMsg = m_state->m_frame->createExtraInfoMessage();
-    if (!infoMsg) {
-        [[maybe_unused]] static constexpr bool Info_must_be_created = false;
-        assert(Info_must_be_created);        
-        return UpdateStatus::NoChange;
+    updateExtraInfoMsg(extraInfo, msg);
+    return UpdateStatus::NoChange;
+}
+
+void ToolsProtocol::createExtraInfoMsgIfNeeded(ToolsMessage& msg)
+{
+    if (property::message::ToolsMsgExtraInfoMsg().getFrom(msg)) {
+        return;
     }
 
-    auto jsonObj = QJsonObject::fromVariantMap(extraInfo);
-    QJsonDocument doc(jsonObj);
-    auto jsonByteArray = doc.toJson();
-    MsgDataSeq dataSeq;
-    dataSeq.reserve(static_cast<std::size_t>(jsonByteArray.size()));
-    std::copy_n(jsonByteArray.constData(), jsonByteArray.size(), std::back_inserter(dataSeq));
-    if (!infoMsg->decodeData(dataSeq)) {
-        setExtraInfoMsgToMessageProperties(ToolsMessagePtr(), msg);
-        return UpdateStatus::NoChange;
+    auto extraInfo = getExtraInfoFromMessageProperties(msg);
+    if (extraInfo.isEmpty()) {
+        return;
     }
 
-    setExtraInfoMsgToMessageProperties(std::move(infoMsg), msg);
-    return UpdateStatus::NoChange;
+    updateExtraInfoMsg(extraInfo, msg);
+}
+
+void ToolsProtocol::mergeExtraInfo(const QVariantMap& extraInfo, ToolsMessage& msg)
+{
+    if (extraInfo.isEmpty()) {
+        return;
+    }
+
+    mergeExtraInfoToMessageProperties(extraInfo, msg);
+    if (property::message::ToolsMsgExtraInfoMsg().getFrom(msg)) {
+        setExtraInfoMsgToMessageProperties(ToolsMessagePtr(), msg);
+    }
 }
 
 ToolsMessagePtr ToolsProtocol::cloneMessage(const ToolsMessage& msg)
@@ -272,14 +339,43 @@ ToolsMessagePtr ToolsProtocol::cloneMessage(const ToolsMessage& msg)
     }
 
     auto clonedMsg = msg.clone();
-    if (clonedMsg) {
-        setNameToMessageProperties(*clonedMsg);
+    if (!clonedMsg) {
+        return clonedMsg;
+    }
+
+    setNameToMessageProperties(*clonedMsg);
+    if (property::message::ToolsMsgEncodedData().getFrom(msg)) {
+        // The contents haven't changed since the encoding, share the
+        // derived messages instead of re-encoding. The encoded data itself
+        // is not copied, the clone can be modified independently.
+        property::message::ToolsMsgTransportMsg().copyFromTo(msg, *clonedMsg);
+        property::message::ToolsMsgRawDataMsg().copyFromTo(msg, *clonedMsg);
+        property::message::ToolsMsgFrameSize().copyFromTo(msg, *clonedMsg);
+        property::message::ToolsMsgExtraInfoMsg().copyFromTo(msg, *clonedMsg);
+    }
+    else {
         updateMessage(*clonedMsg);
-        property::message::ToolsMsgExtraInfo().copyFromTo(msg, *clonedMsg);
     }
+
+    property::message::ToolsMsgExtraInfo().copyFromTo(msg, *clonedMsg);
+    property::message::ToolsMsgIdx().copyFromTo(msg, *clonedMsg);
     return clonedMsg;
 }
 
+void ToolsProtocol::cacheEncodedData(ToolsMessage& msg)
+{
+    if (property::message::ToolsMsgEncodedData().getFrom(msg)) {
+        return;
+    }
+
+    auto dataInfo = encodeInternal(msg);
+    if (!dataInfo) {
+        return;
+    }
+
+    property::message::ToolsMsgEncodedData().setTo(std::move(dataInfo), msg);
+}
+
 ToolsMessagePtr ToolsProtocol::createInvalidMessage(const MsgDataSeq& data)
 {
     assert(m_state->m_frame);
@@ -319,6 +415,7 @@ void ToolsProtocol::messageSentReport(ToolsMessagePtr msg)
 
 void ToolsProtocol::applyInterPluginConfig(const QVariantMap& props)
 {
+    invalidateMsgCatalog();
     applyInterPluginConfigImpl(props);
 }
 
@@ -428,6 +525,65 @@ void ToolsProtocol::reportInterPluginConfig(const QVariantMap& props)
     emit sigInterPluginConfigReport(props);
 }
 
+ToolsDataInfoPtr ToolsProtocol::encodeInternal(ToolsMessage& msg)
+{
+    if (msg.idAsString().isEmpty()) {
+
+        auto rawDataMsg = property::message::ToolsMsgRawDataMsg().getFrom(msg);
+        if (!rawDataMsg) {
+            return ToolsDataInfoPtr();
+        }
+
+        auto dataInfoPtr = makeDataInfo();
+        assert(dataInfoPtr);
+
+        dataInfoPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+        dataInfoPtr->m_data = rawDataMsg->encodeData();
+
+        return dataInfoPtr;
+    }
+
+    auto dataInfo = makeDataInfo();
+    assert(dataInfo);
+
+    dataInfo->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    dataInfo->m_data = msg.encodeFramed(*m_state->m_frame);
+    dataInfo->m_extraProperties = getExtraInfoFromMessageProperties(msg);
+    return dataInfo;
+}
+
+void ToolsProtocol::prepareCreatedMessage(ToolsMessage& msg, unsigned idx)
+{
+    property::message::ToolsMsgIdx().setTo(idx, msg);
+    setNameToMessageProperties(msg);
+    setForceExtraInfoExistenceToMessageProperties(msg);
+    updateMessage(msg);
+}
+
+void ToolsProtocol::updateExtraInfoMsg(const QVariantMap& extraInfo, ToolsMessage& msg)
+{
+    assert(m_state->m_frame);
+    auto infoMsg = m_state->m_frame->createExtraInfoMessage();
+    if (!infoMsg) {
+        [[maybe_unused]] static constexpr bool Info_must_be_created = false;
+        assert(Info_must_be_created);        
+        return;
+    }
+
+    auto jsonObj = QJsonObject::fromVariantMap(extraInfo);
+    QJsonDocument doc(jsonObj);
+    auto jsonByteArray = doc.toJson();
+    MsgDataSeq dataSeq;
+    dataSeq.reserve(static_cast<std::size_t>(jsonByteArray.size()));
+    std::copy_n(jsonByteArray.constData(), jsonByteArray.size(), std::back_inserter(dataSeq));
+    if (!infoMsg->decodeData(dataSeq)) {
+        setExtraInfoMsgToMessageProperties(ToolsMessagePtr(), msg);
+        return;
+    }
+
+    setExtraInfoMsgToMessageProperties(std::move(infoMsg), msg);
+}
+
 }  // namespace cc_tools_qt
 
 
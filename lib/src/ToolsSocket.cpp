@@ -17,6 +17,7 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include <cassert>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -47,6 +48,23 @@ std::string dataToStr(const ToolsDataInfo::DataSeq& data)
     return stream.str();
 }
 
+void prepareSendData(ToolsDataInfo& data, unsigned debugLevel)
+{
+    if (data.m_timestamp == ToolsDataInfo::Timestamp()) {
+        data.m_timestamp = ToolsDataInfo::TimestampClock::now();
+    }
+
+    if (1U < debugLevel) {
+        auto sinceEpoch = data.m_timestamp.time_since_epoch();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
+        std::cout << '[' << milliseconds << "] " << debugPrefix() << " --> " << data.m_data.size() << " bytes"; 
+        if (2U < debugLevel) {
+            std::cout << " | " << dataToStr(data.m_data);
+        }
+        std::cout << std::endl;
+    }
+}
+
 } // namespace 
 
 struct ToolsSocket::InnerState
@@ -109,21 +127,22 @@ void ToolsSocket::sendData(ToolsDataInfoPtr dataPtr)
         return;
     }
 
-    if (dataPtr->m_timestamp == ToolsDataInfo::Timestamp()) {
-        dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    prepareSendData(*dataPtr, m_state->m_debugLevel);
+    sendDataImpl(std::move(dataPtr));
+}
+
+void ToolsSocket::sendData(const QList<ToolsDataInfoPtr>& dataList)
+{
+    if ((!isSocketConnected()) || dataList.isEmpty()) {
+        return;
     }
 
-    if (1U < m_state->m_debugLevel) {
-        auto sinceEpoch = dataPtr->m_timestamp.time_since_epoch();
-        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch).count();
-        std::cout << '[' << milliseconds << "] " << debugPrefix() << " --> " << dataPtr->m_data.size() << " bytes"; 
-        if (2U < m_state->m_debugLevel) {
-            std::cout << " | " << dataToStr(dataPtr->m_data);
-        }
-        std::cout << std::endl;
+    for (auto& dataPtr : dataList) {
+        assert(dataPtr);
+        prepareSendData(*dataPtr, m_state->m_debugLevel);
     }
 
-    sendDataImpl(std::move(dataPtr));
+    sendDataListImpl(dataList);
 }
 
 unsigned ToolsSocket::connectionProperties() const
@@ -131,6 +150,11 @@ unsigned ToolsSocket::connectionProperties() const
     return connectionPropertiesImpl();
 }
 
+unsigned long long ToolsSocket::sendBacklog() const
+{
+    return sendBacklogImpl();
+}
+
 void ToolsSocket::applyInterPluginConfig(const QVariantMap& props)
 {
     applyInterPluginConfigImpl(props);
@@ -159,11 +183,23 @@ void ToolsSocket::socketDisconnectImpl()
 {
 }
 
+void ToolsSocket::sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList)
+{
+    for (auto& dataPtr : dataList) {
+        sendDataImpl(dataPtr);
+    }
+}
+
 unsigned ToolsSocket::connectionPropertiesImpl() const
 {
     return 0U;
 }
 
+unsigned long long ToolsSocket::sendBacklogImpl() const
+{
+    return 0U;
+}
+
 void ToolsSocket::applyInterPluginConfigImpl([[maybe_unused]] const QVariantMap& props)
 {
 }
@@ -177,6 +213,23 @@ unsigned long long ToolsSocket::currTimestamp()
     return milliseconds;
 }
 
+QByteArray ToolsSocket::coalesceData(const QList<ToolsDataInfoPtr>& dataList)
+{
+    int totalSize = 0;
+    for (auto& dataPtr : dataList) {
+        assert(dataPtr);
+        totalSize += static_cast<int>(dataPtr->m_data.size());
+    }
+
+    QByteArray buf;
+    buf.reserve(totalSize);
+    for (auto& dataPtr : dataList) {
+        buf.append(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<int>(dataPtr->m_data.size()));
+    }
+
+    return buf;
+}
+
 unsigned ToolsSocket::getDebugOutputLevel() const
 {
     return m_state->m_debugLevel;
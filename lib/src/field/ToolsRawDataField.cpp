@@ -19,6 +19,8 @@
 
 #include "cc_tools_qt/ToolsFieldHandler.h"
 
+#include <algorithm>
+
 namespace cc_tools_qt
 {
 
@@ -49,6 +51,47 @@ int ToolsRawDataField::minSize() const
     return minSizeImpl();
 }
 
+int ToolsRawDataField::dataSize() const
+{
+    return dataSizeImpl();
+}
+
+ToolsRawDataField::DataSeq ToolsRawDataField::getData(int from, int count) const
+{
+    auto size = dataSize();
+    if ((from < 0) || (count <= 0) || (size <= from)) {
+        return DataSeq();
+    }
+
+    return getDataImpl(from, std::min(count, size - from));
+}
+
+bool ToolsRawDataField::setData(int from, const DataSeq& data)
+{
+    if ((from < 0) || ((dataSize() - from) < static_cast<int>(data.size()))) {
+        return false;
+    }
+
+    if (data.empty()) {
+        return true;
+    }
+
+    return setDataImpl(from, data);
+}
+
+bool ToolsRawDataField::resizeData(int size)
+{
+    if ((size < minSize()) || (maxSize() < size)) {
+        return false;
+    }
+
+    if (size == dataSize()) {
+        return true;
+    }
+
+    return resizeDataImpl(size);
+}
+
 bool ToolsRawDataField::getForcedShowAll() const
 {
     return m_forcedShowAll;
@@ -32,9 +32,11 @@ ToolsMsgTimestamp::ToolsMsgTimestamp() : Base("cc.msg_timestamp") {}
 ToolsMsgProtocolName::ToolsMsgProtocolName() : Base("cc.msg_prot_name") {}
 ToolsMsgTransportMsg::ToolsMsgTransportMsg() : Base("cc.msg_transport") {}
 ToolsMsgRawDataMsg::ToolsMsgRawDataMsg() : Base("cc.msg_raw_data") {} 
+ToolsMsgFrameSize::ToolsMsgFrameSize() : Base("cc.msg_frame_size") {} 
 ToolsMsgExtraInfoMsg::ToolsMsgExtraInfoMsg() : Base("cc.msg_extra_info") {} 
 ToolsMsgExtraInfo::ToolsMsgExtraInfo() : Base("cc.msg_extra_info_map") {} 
 ToolsMsgForceExtraInfoExistence::ToolsMsgForceExtraInfoExistence() : Base("cc.force_extra_info_exist") {} 
+ToolsMsgEncodedData::ToolsMsgEncodedData() : Base("cc.msg_encoded_data") {} 
 ToolsMsgDelay::ToolsMsgDelay() : Base("cc.msg_delay") {} 
 ToolsMsgDelayUnits::ToolsMsgDelayUnits() : Base("cc.msg_delay_units") {} 
 ToolsMsgRepeatDuration::ToolsMsgRepeatDuration() : Base("cc.msg_repeat") {} 
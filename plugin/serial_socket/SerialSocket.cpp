@@ -93,6 +93,17 @@ void SerialSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         static_cast<qint64>(dataPtr->m_data.size()));
 }
 
+void SerialSocket::sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList)
+{
+    // Coalesce all the data chunks into a single write
+    m_serial.write(coalesceData(dataList));
+}
+
+unsigned long long SerialSocket::sendBacklogImpl() const
+{
+    return static_cast<unsigned long long>(m_serial.bytesToWrite());
+}
+
 void SerialSocket::performRead()
 {
     assert(sender() == &m_serial);
@@ -80,6 +80,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList) override;
+    virtual unsigned long long sendBacklogImpl() const override;
 
 private slots:
     void performRead();
@@ -156,6 +156,7 @@ bool SslClientSocket::socketConnectImpl()
         return false;
     }
 
+    updateEndpointProps();
     return true;
 }
 
@@ -166,6 +167,8 @@ void SslClientSocket::socketDisconnectImpl()
     m_socket.disconnectFromHost();
     m_socket.close();
     m_socket.blockSignals(false);
+    m_recvProps.clear();
+    m_sendProps.clear();
 }
 
 void SslClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
@@ -175,17 +178,30 @@ void SslClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         static_cast<qint64>(dataPtr->m_data.size()));
 
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    QString to =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
+    if (m_sendProps.isEmpty()) {
+        updateEndpointProps();
+    }
+
+    dataPtr->mergeExtraProperties(m_sendProps);
+}
 
+void SslClientSocket::sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList)
+{
+    // Coalesce all the data chunks into a single write
+    m_socket.write(coalesceData(dataList));
 
-    dataPtr->m_extraProperties.insert(sslFromProp(), from);
-    dataPtr->m_extraProperties.insert(sslToProp(), to);
+    if (m_sendProps.isEmpty()) {
+        updateEndpointProps();
+    }
 
+    for (auto& dataPtr : dataList) {
+        dataPtr->mergeExtraProperties(m_sendProps);
+    }
+}
+
+unsigned long long SslClientSocket::sendBacklogImpl() const
+{
+    return static_cast<unsigned long long>(m_socket.encryptedBytesToWrite() + m_socket.bytesToWrite());
 }
 
 void SslClientSocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -236,6 +252,8 @@ void SslClientSocket::applyInterPluginConfigImpl(const QVariantMap& props)
 
 void SslClientSocket::socketDisconnected()
 {
+    m_recvProps.clear();
+    m_sendProps.clear();
     reportDisconnected();
 }
 
@@ -255,15 +273,11 @@ void SslClientSocket::readFromSocket()
         dataPtr->m_data.resize(static_cast<std::size_t>(result));
     }
 
-    QString from =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
-    QString to =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
+    if (m_recvProps.isEmpty()) {
+        updateEndpointProps();
+    }
 
-    dataPtr->m_extraProperties.insert(sslFromProp(), from);
-    dataPtr->m_extraProperties.insert(sslToProp(), to);
+    dataPtr->m_extraProperties = m_recvProps;
     reportDataReceived(std::move(dataPtr));
 }
 
@@ -304,6 +318,25 @@ void SslClientSocket::sslErrorsOccurred(const QList<QSslError>& errs)
     }
 }
 
+void SslClientSocket::updateEndpointProps()
+{
+    // The endpoints don't change while connected, all the data chunks share the same properties
+    QString local =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+    QString peer =
+        m_socket.peerAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.peerPort());
+
+    m_recvProps.clear();
+    m_recvProps.insert(sslFromProp(), peer);
+    m_recvProps.insert(sslToProp(), local);
+
+    m_sendProps.clear();
+    m_sendProps.insert(sslFromProp(), local);
+    m_sendProps.insert(sslToProp(), peer);
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
@@ -201,6 +201,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList) override;
+    virtual unsigned long long sendBacklogImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;     
 
 private slots:
@@ -210,6 +212,8 @@ private slots:
     void sslErrorsOccurred(const QList<QSslError>& errs);
 
 private:
+    void updateEndpointProps();
+
     static const PortType DefaultPort = SSL_CLIENT_DEFAULT_PORT;
     QString m_host;
     PortType m_port = DefaultPort;
@@ -227,6 +231,8 @@ private:
     QSsl::EncodingFormat m_privKeyFormat = QSsl::Pem;
     QString m_privKeyPass;
     QSslSocket m_socket;
+    QVariantMap m_recvProps;
+    QVariantMap m_sendProps;
 };
 
 } // namespace plugin
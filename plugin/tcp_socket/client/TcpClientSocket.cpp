@@ -116,6 +116,7 @@ bool TcpClientSocket::socketConnectImpl()
         return false;
     }
 
+    updateEndpointProps();
     return true;
 }
 
@@ -126,6 +127,8 @@ void TcpClientSocket::socketDisconnectImpl()
     m_socket.disconnectFromHost();
     m_socket.close();
     m_socket.blockSignals(false);
+    m_recvProps.clear();
+    m_sendProps.clear();
 }
 
 void TcpClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
@@ -135,17 +138,30 @@ void TcpClientSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         static_cast<qint64>(dataPtr->m_data.size()));
 
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    QString to =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
+    if (m_sendProps.isEmpty()) {
+        updateEndpointProps();
+    }
+
+    dataPtr->mergeExtraProperties(m_sendProps);
+}
 
+void TcpClientSocket::sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList)
+{
+    // Coalesce all the data chunks into a single write
+    m_socket.write(coalesceData(dataList));
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    if (m_sendProps.isEmpty()) {
+        updateEndpointProps();
+    }
 
+    for (auto& dataPtr : dataList) {
+        dataPtr->mergeExtraProperties(m_sendProps);
+    }
+}
+
+unsigned long long TcpClientSocket::sendBacklogImpl() const
+{
+    return static_cast<unsigned long long>(m_socket.bytesToWrite());
 }
 
 void TcpClientSocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -188,6 +204,8 @@ void TcpClientSocket::socketDisconnected()
 //        tr("Connection to TCP/IP Server was disconnected."));
 //    reportError(DisconnectedError);
 
+    m_recvProps.clear();
+    m_sendProps.clear();
     reportDisconnected();
 }
 
@@ -207,15 +225,11 @@ void TcpClientSocket::readFromSocket()
         dataPtr->m_data.resize(static_cast<std::size_t>(result));
     }
 
-    QString from =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
-    QString to =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
+    if (m_recvProps.isEmpty()) {
+        updateEndpointProps();
+    }
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    dataPtr->m_extraProperties = m_recvProps;
     reportDataReceived(std::move(dataPtr));
 }
 
@@ -231,6 +245,25 @@ void TcpClientSocket::socketErrorOccurred([[maybe_unused]] QAbstractSocket::Sock
     }
 }
 
+void TcpClientSocket::updateEndpointProps()
+{
+    // The endpoints don't change while connected, all the data chunks share the same properties
+    QString local =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+    QString peer =
+        m_socket.peerAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.peerPort());
+
+    m_recvProps.clear();
+    m_recvProps.insert(tcpFromProp(), peer);
+    m_recvProps.insert(tcpToProp(), local);
+
+    m_sendProps.clear();
+    m_sendProps.insert(tcpFromProp(), local);
+    m_sendProps.insert(tcpToProp(), peer);
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
@@ -71,6 +71,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList) override;
+    virtual unsigned long long sendBacklogImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;     
 
 private slots:
@@ -81,11 +83,14 @@ private slots:
 private:
     QString getHostValue() const;
     PortType getPortValue() const;
+    void updateEndpointProps();
 
     static const PortType DefaultPort = TCP_CLIENT_DEFAULT_PORT;
     QString m_host;
     PortType m_port = DefaultPort;
     QTcpSocket m_socket;
+    QVariantMap m_recvProps;
+    QVariantMap m_sendProps;
 };
 
 } // namespace plugin
@@ -21,6 +21,7 @@
 #include <QtNetwork/QHostAddress>
 
 #include <cassert>
+#include <iostream>
 
 namespace cc_tools_qt
 {
@@ -79,6 +80,11 @@ const QString& networkLocalPortProp()
     return Str;
 }
 
+QString endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString::number(port);
+}
+
 }  // namespace
 
 TcpProxySocket::TcpProxySocket()
@@ -94,9 +100,26 @@ TcpProxySocket::TcpProxySocket()
 
 TcpProxySocket::~TcpProxySocket() noexcept
 {
-    while (!m_sockets.empty()) {
-        removeConnection(m_sockets.begin());
+    while (!m_connections.empty()) {
+        removeConnection(*m_connections.begin()->second);
+    }
+}
+
+void TcpProxySocket::setMaxConnections(unsigned value)
+{
+    m_maxConnections = value;
+    acceptConnections();
+}
+
+TcpProxySocket::ConnectionsStatsList TcpProxySocket::connectionsStats() const
+{
+    ConnectionsStatsList result;
+    result.reserve(m_connections.size());
+    for (auto& elem : m_connections) {
+        assert(elem.second);
+        result.push_back(elem.second->m_stats);
     }
+    return result;
 }
 
 bool TcpProxySocket::socketConnectImpl()
@@ -134,6 +157,8 @@ bool TcpProxySocket::socketConnectImpl()
         return false;
     }
 
+    m_localEndpoint = endpointStr(m_server.serverAddress(), m_server.serverPort());
+    acceptConnections();
     return true;
 }
 
@@ -145,30 +170,28 @@ void TcpProxySocket::socketDisconnectImpl()
 void TcpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
     assert(dataPtr);
+    auto dataSize = dataPtr->m_data.size();
     QVariantList toList;
-    for (auto& connectedPair : m_sockets) {
-        assert(connectedPair.first != nullptr);
-        assert(connectedPair.second);
-        connectedPair.first->write(
+    toList.reserve(static_cast<int>(m_connections.size() * 2U));
+    for (auto& elem : m_connections) {
+        auto& info = *elem.second;
+        assert(info.m_client != nullptr);
+        assert(info.m_connection);
+        info.m_client->write(
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
-        connectedPair.second->write(
+            static_cast<qint64>(dataSize));
+        info.m_connection->write(
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
+            static_cast<qint64>(dataSize));
 
-        toList.append(
-            connectedPair.first->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.first->peerPort()));
+        info.m_stats.m_txBytes += dataSize;
+        ++info.m_stats.m_txCount;
 
-        toList.append(
-            connectedPair.second->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.second->peerPort()));
+        toList.append(info.m_stats.m_clientEndpoint);
+        toList.append(info.m_stats.m_remoteEndpoint);
     }
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
+    dataPtr->m_extraProperties.insert(tcpFromProp(), m_localEndpoint);
     dataPtr->m_extraProperties.insert(tcpToProp(), toList);
 }
 
@@ -226,35 +249,7 @@ void TcpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
 
 void TcpProxySocket::newConnection()
 {
-    auto *newConnSocket = m_server.nextPendingConnection();
-    connect(
-        newConnSocket, &QTcpSocket::disconnected,
-        this, &TcpProxySocket::clientConnectionTerminated);
-    connect(
-        newConnSocket, &QTcpSocket::errorOccurred,
-        this, &TcpProxySocket::socketErrorOccurred);
-
-    ConnectionSocketPtr connectionSocket(new QTcpSocket);
-    connect(
-        connectionSocket.get(), &QTcpSocket::connected,
-        this, &TcpProxySocket::connectionSocketConnected);
-    connect(
-        connectionSocket.get(), &QTcpSocket::disconnected,
-        this, &TcpProxySocket::connectionSocketDisconnected);
-    connect(
-        connectionSocket.get(), &QTcpSocket::readyRead,
-        this, &TcpProxySocket::readFromConnectionSocket);
-
-    connect(
-        connectionSocket.get(), &QTcpSocket::errorOccurred,
-        this, &TcpProxySocket::socketErrorOccurred);
-
-    if (m_remoteHost.isEmpty()) {
-        m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
-    }
-
-    connectionSocket->connectToHost(m_remoteHost, m_remotePort);
-    m_sockets.emplace_back(newConnSocket, std::move(connectionSocket));
+    acceptConnections();
 }
 
 void TcpProxySocket::clientConnectionTerminated()
@@ -266,17 +261,19 @@ void TcpProxySocket::clientConnectionTerminated()
         return;
     }
 
-    auto iter = findByClient(socket);
-    if (iter == m_sockets.end()) {
+    auto* info = findByClient(socket);
+    if (info == nullptr) {
         return;
     }
 
-    assert(iter->second);
+    auto infoPtr = takeConnection(*info);
+    assert(infoPtr->m_connection);
     socket->blockSignals(true);
-    iter->second->blockSignals(true);
-    iter->second->flush();
-    m_sockets.erase(iter);
+    infoPtr->m_connection->blockSignals(true);
+    infoPtr->m_connection->flush();
+    infoPtr.reset();
     socket->deleteLater();
+    acceptConnections();
 }
 
 void TcpProxySocket::readFromClientSocket()
@@ -284,12 +281,14 @@ void TcpProxySocket::readFromClientSocket()
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
 
-    auto iter = findByClient(socket);
-    assert (iter != m_sockets.end());
-    assert(iter->second);
-    auto& connectionSocket = *(iter->second);
+    auto* info = findByClient(socket);
+    if (info == nullptr) {
+        [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
+        assert(Must_have_found_socket);
+        return;
+    }
 
-    performReadWrite(*socket, connectionSocket);
+    performReadWrite(*info, true);
 }
 
 void TcpProxySocket::socketErrorOccurred(QAbstractSocket::SocketError err)
@@ -322,17 +321,23 @@ void TcpProxySocket::connectionSocketConnected()
         return;
     }
 
-    auto iter = findByConnection(socket);
-    assert(iter != m_sockets.end());
-    assert(iter->first != nullptr);
+    auto* info = findByConnection(socket);
+    if (info == nullptr) {
+        [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
+        assert(Must_have_found_socket);
+        return;
+    }
+
+    assert(info->m_client != nullptr);
+    info->m_stats.m_remoteEndpoint = endpointStr(socket->peerAddress(), socket->peerPort());
+    updateConnectionProps(*info);
 
     connect(
-        iter->first, SIGNAL(readyRead()),
+        info->m_client, SIGNAL(readyRead()),
         this, SLOT(readFromClientSocket()));
 
-    if (0 < iter->first->bytesAvailable()) {
-        assert(iter->second);
-        performReadWrite(*iter->first, *iter->second);
+    if (0 < info->m_client->bytesAvailable()) {
+        performReadWrite(*info, true);
     }
 }
 
@@ -345,20 +350,21 @@ void TcpProxySocket::connectionSocketDisconnected()
         return;
     }
 
-    auto iter = findByConnection(socket);
-    if (iter == m_sockets.end()) {
+    auto* info = findByConnection(socket);
+    if (info == nullptr) {
         return;
     }
 
-    assert(iter->first);
-    iter->first->blockSignals(true);
-    iter->first->flush();
-    delete iter->first;
+    auto infoPtr = takeConnection(*info);
+    assert(infoPtr->m_client);
+    infoPtr->m_client->blockSignals(true);
+    infoPtr->m_client->flush();
+    delete infoPtr->m_client;
 
-    assert(iter->second);
-    iter->second->flush();
-    iter->second.release()->deleteLater();
-    m_sockets.erase(iter);
+    assert(infoPtr->m_connection);
+    infoPtr->m_connection->flush();
+    infoPtr->m_connection.release()->deleteLater();
+    acceptConnections();
 }
 
 void TcpProxySocket::readFromConnectionSocket()
@@ -366,45 +372,64 @@ void TcpProxySocket::readFromConnectionSocket()
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
 
-    auto iter = findByConnection(socket);
-    assert (iter != m_sockets.end());
-    assert(iter->first != nullptr);
-    auto& clientSocket = *(iter->first);
-    performReadWrite(*socket, clientSocket);
+    auto* info = findByConnection(socket);
+    if (info == nullptr) {
+        [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
+        assert(Must_have_found_socket);
+        return;
+    }
+
+    performReadWrite(*info, false);
 }
 
-TcpProxySocket::SocketsList::iterator TcpProxySocket::findByClient(QTcpSocket* socket)
+TcpProxySocket::ConnectionInfo* TcpProxySocket::findByClient(QTcpSocket* socket)
 {
-    return std::find_if(
-        m_sockets.begin(), m_sockets.end(),
-        [socket](const ConnectedPair& elem) -> bool
-        {
-            return elem.first == socket;
-        });
+    auto iter = m_connections.find(socket);
+    if (iter == m_connections.end()) {
+        return nullptr;
+    }
+
+    return iter->second.get();
 }
 
-TcpProxySocket::SocketsList::iterator TcpProxySocket::findByConnection(QTcpSocket* socket)
+TcpProxySocket::ConnectionInfo* TcpProxySocket::findByConnection(QTcpSocket* socket)
 {
-    return std::find_if(
-        m_sockets.begin(), m_sockets.end(),
-        [socket](const ConnectedPair& elem) -> bool
-        {
-            return elem.second.get() == socket;
-        });
+    auto iter = m_connectionSockets.find(socket);
+    if (iter == m_connectionSockets.end()) {
+        return nullptr;
+    }
 
+    return iter->second;
 }
 
-void TcpProxySocket::removeConnection(SocketsList::iterator iter)
+TcpProxySocket::ConnectionInfoPtr TcpProxySocket::takeConnection(ConnectionInfo& info)
 {
-    assert(iter != m_sockets.end());
-    auto* clientSocket = iter->first;
+    m_connectionSockets.erase(info.m_connection.get());
+
+    auto iter = m_connections.find(info.m_client);
+    assert(iter != m_connections.end());
+    auto infoPtr = std::move(iter->second);
+    m_connections.erase(iter);
+
+    if (0U < getDebugOutputLevel()) {
+        auto& stats = infoPtr->m_stats;
+        std::cout << "(tcp_proxy) " << stats.m_clientEndpoint.toStdString() << " <-> " << stats.m_remoteEndpoint.toStdString() << " disconnected: " <<
+            "forwarded " << stats.m_clientBytes << " bytes in " << stats.m_clientCount << " chunks from client, " <<
+            stats.m_remoteBytes << " bytes in " << stats.m_remoteCount << " chunks from remote, " <<
+            "sent " << stats.m_txBytes << " bytes in " << stats.m_txCount << " chunks" << std::endl;
+    }
+
+    return infoPtr;
+}
+
+void TcpProxySocket::removeConnection(ConnectionInfo& info)
+{
+    auto infoPtr = takeConnection(info);
+    auto* clientSocket = infoPtr->m_client;
     assert(clientSocket);
 
-    ConnectionSocketPtr connectionSocket(std::move(iter->second));
+    ConnectionSocketPtr connectionSocket(std::move(infoPtr->m_connection));
     assert(connectionSocket);
-    assert(!iter->second);
-
-    m_sockets.erase(iter);
 
     clientSocket->blockSignals(true);
     connectionSocket->blockSignals(true);
@@ -421,8 +446,93 @@ void TcpProxySocket::removeConnection(SocketsList::iterator iter)
     }
 }
 
-void TcpProxySocket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket)
+void TcpProxySocket::acceptConnections()
 {
+    if (!m_server.isListening()) {
+        return;
+    }
+
+    while (m_server.hasPendingConnections() && (!connectionsLimitReached())) {
+        addConnection(m_server.nextPendingConnection());
+    }
+
+    // The further clients wait in the listen backlog until some connection is terminated
+    if (connectionsLimitReached()) {
+        m_server.pauseAccepting();
+        return;
+    }
+
+    m_server.resumeAccepting();
+}
+
+void TcpProxySocket::addConnection(QTcpSocket* newConnSocket)
+{
+    assert(newConnSocket != nullptr);
+    connect(
+        newConnSocket, &QTcpSocket::disconnected,
+        this, &TcpProxySocket::clientConnectionTerminated);
+    connect(
+        newConnSocket, &QTcpSocket::errorOccurred,
+        this, &TcpProxySocket::socketErrorOccurred);
+
+    ConnectionSocketPtr connectionSocket(new QTcpSocket);
+    connect(
+        connectionSocket.get(), &QTcpSocket::connected,
+        this, &TcpProxySocket::connectionSocketConnected);
+    connect(
+        connectionSocket.get(), &QTcpSocket::disconnected,
+        this, &TcpProxySocket::connectionSocketDisconnected);
+    connect(
+        connectionSocket.get(), &QTcpSocket::readyRead,
+        this, &TcpProxySocket::readFromConnectionSocket);
+
+    connect(
+        connectionSocket.get(), &QTcpSocket::errorOccurred,
+        this, &TcpProxySocket::socketErrorOccurred);
+
+    if (m_remoteHost.isEmpty()) {
+        m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
+    }
+
+    auto* connectionSocketPtr = connectionSocket.get();
+    auto infoPtr = std::make_unique<ConnectionInfo>();
+    infoPtr->m_client = newConnSocket;
+    infoPtr->m_connection = std::move(connectionSocket);
+
+    // Remote endpoint is updated with the resolved address when connected
+    infoPtr->m_stats.m_clientEndpoint = endpointStr(newConnSocket->peerAddress(), newConnSocket->peerPort());
+    infoPtr->m_stats.m_remoteEndpoint = m_remoteHost + ':' + QString::number(m_remotePort);
+    updateConnectionProps(*infoPtr);
+
+    m_connectionSockets[connectionSocketPtr] = infoPtr.get();
+    m_connections[newConnSocket] = std::move(infoPtr);
+
+    connectionSocketPtr->connectToHost(m_remoteHost, m_remotePort);
+}
+
+void TcpProxySocket::updateConnectionProps(ConnectionInfo& info)
+{
+    // Shared by all the data chunks of the connection
+    info.m_clientProps.clear();
+    info.m_clientProps.insert(tcpFromProp(), info.m_stats.m_clientEndpoint);
+    info.m_clientProps.insert(tcpToProp(), info.m_stats.m_remoteEndpoint);
+
+    info.m_remoteProps.clear();
+    info.m_remoteProps.insert(tcpFromProp(), info.m_stats.m_remoteEndpoint);
+    info.m_remoteProps.insert(tcpToProp(), info.m_stats.m_clientEndpoint);
+}
+
+bool TcpProxySocket::connectionsLimitReached() const
+{
+    return (0U < m_maxConnections) && (m_maxConnections <= m_connections.size());
+}
+
+void TcpProxySocket::performReadWrite(ConnectionInfo& info, bool fromClient)
+{
+    assert(info.m_client != nullptr);
+    assert(info.m_connection);
+    auto& readFromSocket = fromClient ? *info.m_client : *info.m_connection;
+    auto& writeToSocket = fromClient ? *info.m_connection : *info.m_client;
     if (readFromSocket.bytesAvailable() == 0) {
         return;
     }
@@ -442,16 +552,17 @@ void TcpProxySocket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& wr
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         static_cast<qint64>(dataPtr->m_data.size()));
 
-    QString from =
-        readFromSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(readFromSocket.peerPort());
-    QString to =
-        writeToSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(writeToSocket.peerPort());
-
-
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    auto& stats = info.m_stats;
+    if (fromClient) {
+        stats.m_clientBytes += dataPtr->m_data.size();
+        ++stats.m_clientCount;
+        dataPtr->m_extraProperties = info.m_clientProps;
+    }
+    else {
+        stats.m_remoteBytes += dataPtr->m_data.size();
+        ++stats.m_remoteCount;
+        dataPtr->m_extraProperties = info.m_remoteProps;
+    }
 
     reportDataReceived(std::move(dataPtr));
 }
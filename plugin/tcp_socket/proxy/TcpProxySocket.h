@@ -22,9 +22,9 @@
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
 
-#include <list>
 #include <memory>
-#include <utility>
+#include <unordered_map>
+#include <vector>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
 #define TCP_PROXY_DEFAULT_PORT CC_TOOLS_QT_DEFAULT_NETWORK_PORT    
@@ -46,6 +46,20 @@ class TcpProxySocket : public cc_tools_qt::ToolsSocket
 public:
     typedef unsigned short PortType;
 
+    struct ConnectionStats
+    {
+        QString m_clientEndpoint;
+        QString m_remoteEndpoint;
+        unsigned long long m_clientBytes = 0U; // forwarded from client to remote
+        unsigned long long m_clientCount = 0U;
+        unsigned long long m_remoteBytes = 0U; // forwarded from remote to client
+        unsigned long long m_remoteCount = 0U;
+        unsigned long long m_txBytes = 0U; // injected by sendData()
+        unsigned long long m_txCount = 0U;
+    };
+
+    typedef std::vector<ConnectionStats> ConnectionsStatsList;
+
     TcpProxySocket();
     ~TcpProxySocket() noexcept;
 
@@ -79,6 +93,21 @@ public:
         return m_remotePort;
     }
 
+    // 0 means unlimited
+    void setMaxConnections(unsigned value);
+
+    unsigned getMaxConnections() const
+    {
+        return m_maxConnections;
+    }
+
+    std::size_t connectionsCount() const
+    {
+        return m_connections.size();
+    }
+
+    ConnectionsStatsList connectionsStats() const;
+
 signals:
     void sigConfigChanged();      
 
@@ -102,21 +131,40 @@ private slots:
 private:
     typedef QTcpSocket* ClientSocketPtr;
     typedef std::unique_ptr<QTcpSocket> ConnectionSocketPtr;
-    typedef std::pair<ClientSocketPtr, ConnectionSocketPtr> ConnectedPair;
-    typedef std::list<ConnectedPair> SocketsList;
 
-    SocketsList::iterator findByClient(QTcpSocket* socket);
-    SocketsList::iterator findByConnection(QTcpSocket* socket);
-    void removeConnection(SocketsList::iterator iter);
-    void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket);
+    struct ConnectionInfo
+    {
+        ClientSocketPtr m_client = nullptr;
+        ConnectionSocketPtr m_connection;
+        ConnectionStats m_stats;
+        QVariantMap m_clientProps;
+        QVariantMap m_remoteProps;
+    };
+
+    typedef std::unique_ptr<ConnectionInfo> ConnectionInfoPtr;
+    typedef std::unordered_map<QTcpSocket*, ConnectionInfoPtr> ConnectionsMap; // by client socket
+    typedef std::unordered_map<QTcpSocket*, ConnectionInfo*> ConnectionSocketsMap; // by connection socket
+
+    ConnectionInfo* findByClient(QTcpSocket* socket);
+    ConnectionInfo* findByConnection(QTcpSocket* socket);
+    ConnectionInfoPtr takeConnection(ConnectionInfo& info);
+    void removeConnection(ConnectionInfo& info);
+    void acceptConnections();
+    void addConnection(QTcpSocket* newConnSocket);
+    bool connectionsLimitReached() const;
+    static void updateConnectionProps(ConnectionInfo& info);
+    void performReadWrite(ConnectionInfo& info, bool fromClient);
 
     static const PortType DefaultPort = TCP_PROXY_DEFAULT_PORT;
     PortType m_port = DefaultPort;
     QString m_remoteHost;
     PortType m_remotePort = DefaultPort;
+    unsigned m_maxConnections = 0U;
+    QString m_localEndpoint;
 
     QTcpServer m_server;
-    SocketsList m_sockets;
+    ConnectionsMap m_connections;
+    ConnectionSocketsMap m_connectionSockets;
 };
 
 } // namespace plugin
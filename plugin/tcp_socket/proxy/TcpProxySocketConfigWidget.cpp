@@ -41,6 +41,8 @@ TcpProxySocketConfigWidget::TcpProxySocketConfigWidget(
         1,
         static_cast<int>(std::numeric_limits<PortType>::max()));
 
+    m_ui.m_maxConnectionsSpinBox->setRange(0, std::numeric_limits<int>::max());
+
     refresh();        
 
     connect(
@@ -58,6 +60,10 @@ TcpProxySocketConfigWidget::TcpProxySocketConfigWidget(
     connect(
         m_ui.m_remotePortSpinBox, qOverload<int>(&QSpinBox::valueChanged),
         this, &TcpProxySocketConfigWidget::remotePortValueChanged);
+
+    connect(
+        m_ui.m_maxConnectionsSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+        this, &TcpProxySocketConfigWidget::maxConnectionsValueChanged);
 }
 
 TcpProxySocketConfigWidget::~TcpProxySocketConfigWidget() noexcept = default;
@@ -71,6 +77,9 @@ void TcpProxySocketConfigWidget::refresh()
 
     m_ui.m_remotePortSpinBox->setValue(
         static_cast<int>(m_socket.getRemotePort()));    
+
+    m_ui.m_maxConnectionsSpinBox->setValue(
+        static_cast<int>(m_socket.getMaxConnections()));
 }
 
 void TcpProxySocketConfigWidget::localPortValueChanged(int value)
@@ -88,6 +97,11 @@ void TcpProxySocketConfigWidget::remotePortValueChanged(int value)
     m_socket.setRemotePort(static_cast<PortType>(value));
 }
 
+void TcpProxySocketConfigWidget::maxConnectionsValueChanged(int value)
+{
+    m_socket.setMaxConnections(static_cast<unsigned>(value));
+}
+
 }  // namespace plugin
 
 }  // namespace cc_tools_qt
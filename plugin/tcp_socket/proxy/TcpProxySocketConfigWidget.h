@@ -48,6 +48,7 @@ private slots:
     void localPortValueChanged(int value);
     void remoteHostValueChanged(const QString& value);
     void remotePortValueChanged(int value);
+    void maxConnectionsValueChanged(int value);
 
 private:
     TcpProxySocket& m_socket;
@@ -36,6 +36,7 @@ const QString MainConfigKey("cc_tcp_proxy_socket");
 const QString LocalPortSubKey("local_port");
 const QString RemoteHostSubKey("remote_host");
 const QString RemotePortSubKey("remote_port");
+const QString MaxConnectionsSubKey("max_connections");
 
 }  // namespace
 
@@ -54,6 +55,7 @@ void TcpProxySocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(LocalPortSubKey, QVariant::fromValue(m_socket->getPort()));
     subConfig.insert(RemoteHostSubKey, QVariant::fromValue(m_socket->getRemoteHost()));
     subConfig.insert(RemotePortSubKey, QVariant::fromValue(m_socket->getRemotePort()));
+    subConfig.insert(MaxConnectionsSubKey, QVariant::fromValue(m_socket->getMaxConnections()));
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -90,6 +92,11 @@ void TcpProxySocketPlugin::reconfigureImpl(const QVariantMap& config)
     m_socket->setPort(localPort);
     m_socket->setRemoteHost(remoteHost);
     m_socket->setRemotePort(remotePort);
+
+    auto maxConnectionsVar = subConfig.value(MaxConnectionsSubKey);
+    if (maxConnectionsVar.isValid() && maxConnectionsVar.canConvert<unsigned>()) {
+        m_socket->setMaxConnections(maxConnectionsVar.value<unsigned>());
+    }
 }
 
 void TcpProxySocketPlugin::applyInterPluginConfigImpl(const QVariantMap& props)
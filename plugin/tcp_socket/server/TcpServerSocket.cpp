@@ -21,6 +21,7 @@
 #include <QtNetwork/QHostAddress>
 
 #include <cassert>
+#include <iostream>
 
 namespace cc_tools_qt
 {
@@ -68,6 +69,11 @@ const QString& networkLocalPortProp()
     return Str;
 }
 
+QString endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString::number(port);
+}
+
 }  // namespace
 
 TcpServerSocket::TcpServerSocket()
@@ -83,11 +89,27 @@ TcpServerSocket::TcpServerSocket()
 
 TcpServerSocket::~TcpServerSocket() noexcept
 {
-    for (auto* socket : m_sockets) {
-        socket->flush();
+    for (auto& elem : m_connections) {
+        elem.first->flush();
     }
 }
 
+void TcpServerSocket::setMaxConnections(unsigned value)
+{
+    m_maxConnections = value;
+    acceptConnections();
+}
+
+TcpServerSocket::ConnectionsStatsList TcpServerSocket::connectionsStats() const
+{
+    ConnectionsStatsList result;
+    result.reserve(m_connections.size());
+    for (auto& elem : m_connections) {
+        result.push_back(elem.second.m_stats);
+    }
+    return result;
+}
+
 bool TcpServerSocket::socketConnectImpl()
 {
     if (m_server.isListening()) {
@@ -106,6 +128,12 @@ bool TcpServerSocket::socketConnectImpl()
         return false;
     }
 
+    m_localEndpoint = endpointStr(m_server.serverAddress(), m_server.serverPort());
+    for (auto& elem : m_connections) {
+        updateConnectionProps(elem.second);
+    }
+    m_broadcastPropsValid = false;
+    acceptConnections();
     return true;
 }
 
@@ -119,27 +147,87 @@ void TcpServerSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
     assert(dataPtr);
 
-    QVariantList toList;
+    ConnectionsMap::iterator target;
+    if (!resolveTarget(*dataPtr, target)) {
+        return;
+    }
+
+    auto dataSize = dataPtr->m_data.size();
+    if (target != m_connections.end()) {
+        target->first->write(
+            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
+            static_cast<qint64>(dataSize));
 
-    for (auto* socketTmp : m_sockets) {
-        auto* socket = qobject_cast<QTcpSocket*>(socketTmp);
+        auto& info = target->second;
+        info.m_stats.m_txBytes += dataSize;
+        ++info.m_stats.m_txCount;
+        dataPtr->mergeExtraProperties(info.m_sendProps);
+        return;
+    }
+
+    for (auto& elem : m_connections) {
+        auto* socket = elem.first;
         assert(socket != nullptr);
         socket->write(
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            static_cast<qint64>(dataPtr->m_data.size()));
+            static_cast<qint64>(dataSize));
+
+        auto& stats = elem.second.m_stats;
+        stats.m_txBytes += dataSize;
+        ++stats.m_txCount;
+    }
+
+    dataPtr->mergeExtraProperties(broadcastProps());
+}
+
+void TcpServerSocket::sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList)
+{
+    bool broadcast = !m_replyToSender;
+    for (auto& dataPtr : dataList) {
+        if (!broadcast) {
+            break;
+        }
+
+        assert(dataPtr);
+        broadcast = targetEndpoint(*dataPtr).isEmpty();
+    }
 
-        QString to =
-            socket->peerAddress().toString() + ':' +
-                        QString("%1").arg(socket->peerPort());
-        toList.append(to);
+    if (!broadcast) {
+        // Preserve the order of chunks with different destinations
+        for (auto& dataPtr : dataList) {
+            sendDataImpl(dataPtr);
+        }
+        return;
     }
 
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
+    // Coalesce all the data chunks into a single write per client
+    auto buf = coalesceData(dataList);
+
+    for (auto& elem : m_connections) {
+        auto* socket = elem.first;
+        assert(socket != nullptr);
+        socket->write(buf);
 
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
-    dataPtr->m_extraProperties.insert(tcpToProp(), toList);
+        auto& stats = elem.second.m_stats;
+        stats.m_txBytes += static_cast<unsigned long long>(buf.size());
+        stats.m_txCount += static_cast<unsigned long long>(dataList.size());
+    }
+
+    auto& props = broadcastProps();
+    for (auto& dataPtr : dataList) {
+        dataPtr->mergeExtraProperties(props);
+    }
+}
+
+unsigned long long TcpServerSocket::sendBacklogImpl() const
+{
+    unsigned long long result = 0U;
+    for (auto& elem : m_connections) {
+        auto* socket = elem.first;
+        assert(socket != nullptr);
+        result += static_cast<unsigned long long>(socket->bytesToWrite());
+    }
+    return result;
 }
 
 unsigned TcpServerSocket::connectionPropertiesImpl() const
@@ -173,33 +261,41 @@ void TcpServerSocket::applyInterPluginConfigImpl(const QVariantMap& props)
 
 void TcpServerSocket::newConnection()
 {
-    auto *newConnSocket = m_server.nextPendingConnection();
-    m_sockets.push_back(newConnSocket);
-    connect(
-        newConnSocket, &QTcpSocket::disconnected,
-        newConnSocket, &TcpServerSocket::deleteLater);
-    connect(
-        newConnSocket, &QTcpSocket::disconnected,
-        this, &TcpServerSocket::connectionTerminated);
-    connect(
-        newConnSocket, &QTcpSocket::readyRead,
-        this, &TcpServerSocket::readFromSocket);
-    connect(
-        newConnSocket, &QTcpSocket::errorOccurred,
-        this, &TcpServerSocket::socketErrorOccurred);      
+    acceptConnections();
 }
 
 void TcpServerSocket::connectionTerminated()
 {
-    auto* socket = sender();
-    auto iter = std::find(m_sockets.begin(), m_sockets.end(), socket);
-    if (iter == m_sockets.end()) {
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    auto iter = m_connections.find(socket);
+    if (iter == m_connections.end()) {
         [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
         assert(Must_have_found_socket);          
         return;
     }
 
-    m_sockets.erase(iter);
+    auto& info = iter->second;
+    if (0U < getDebugOutputLevel()) {
+        auto& stats = info.m_stats;
+        std::cout << "(tcp_server) " << stats.m_endpoint.toStdString() << " disconnected: " <<
+            "received " << stats.m_rxBytes << " bytes in " << stats.m_rxCount << " chunks, " <<
+            "sent " << stats.m_txBytes << " bytes in " << stats.m_txCount << " chunks" << std::endl;
+    }
+
+    // Release the reassembly context of the connection
+    auto dataPtr = makeDataInfoTimed();
+    dataPtr->m_streamId = info.m_streamId;
+    dataPtr->m_streamEnd = true;
+    m_endpoints.remove(info.m_stats.m_endpoint);
+    m_connections.erase(iter);
+    m_broadcastPropsValid = false;
+    if (m_lastSender == socket) {
+        m_lastSender = nullptr;
+    }
+
+    reportDataReceived(std::move(dataPtr));
+
+    acceptConnections();
 }
 
 void TcpServerSocket::readFromSocket()
@@ -207,8 +303,18 @@ void TcpServerSocket::readFromSocket()
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
 
+    auto iter = m_connections.find(socket);
+    if (iter == m_connections.end()) {
+        [[maybe_unused]] static constexpr bool Must_have_found_socket = false;
+        assert(Must_have_found_socket);          
+        return;
+    }
+
+    m_lastSender = socket;
+    auto& info = iter->second;
     auto dataPtr = makeDataInfo();
     dataPtr->m_timestamp = ToolsDataInfo::TimestampClock::now();
+    dataPtr->m_streamId = info.m_streamId;
 
     auto dataSize = socket->bytesAvailable();
     dataPtr->m_data.resize(static_cast<std::size_t>(dataSize));
@@ -218,15 +324,10 @@ void TcpServerSocket::readFromSocket()
         dataPtr->m_data.resize(static_cast<std::size_t>(result));
     }
 
-    QString from =
-        socket->peerAddress().toString() + ':' +
-                    QString("%1").arg(socket->peerPort());
-    dataPtr->m_extraProperties.insert(tcpFromProp(), from);
+    info.m_stats.m_rxBytes += dataPtr->m_data.size();
+    ++info.m_stats.m_rxCount;
 
-    QString to =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
-    dataPtr->m_extraProperties.insert(tcpToProp(), to);
+    dataPtr->m_extraProperties = info.m_recvProps;
 
     reportDataReceived(std::move(dataPtr));
 }
@@ -252,6 +353,141 @@ void TcpServerSocket::acceptErrorOccurred([[maybe_unused]] QAbstractSocket::Sock
     }
 }
 
+void TcpServerSocket::acceptConnections()
+{
+    if (!m_server.isListening()) {
+        return;
+    }
+
+    while (m_server.hasPendingConnections() && (!connectionsLimitReached())) {
+        addConnection(m_server.nextPendingConnection());
+    }
+
+    // The further clients wait in the listen backlog until some connection is terminated
+    if (connectionsLimitReached()) {
+        m_server.pauseAccepting();
+        return;
+    }
+
+    m_server.resumeAccepting();
+}
+
+void TcpServerSocket::addConnection(QTcpSocket* newConnSocket)
+{
+    assert(newConnSocket != nullptr);
+
+    // Every connection is a separate stream of the received data
+    ++m_nextStreamId;
+    if (m_nextStreamId == ToolsDataInfo::DefaultStreamId) {
+        ++m_nextStreamId;
+    }
+
+    auto& info = m_connections[newConnSocket];
+    info.m_streamId = m_nextStreamId;
+    info.m_stats.m_endpoint = endpointStr(newConnSocket->peerAddress(), newConnSocket->peerPort());
+    m_endpoints.insert(info.m_stats.m_endpoint, newConnSocket);
+    updateConnectionProps(info);
+    m_broadcastPropsValid = false;
+
+    connect(
+        newConnSocket, &QTcpSocket::disconnected,
+        newConnSocket, &TcpServerSocket::deleteLater);
+    connect(
+        newConnSocket, &QTcpSocket::disconnected,
+        this, &TcpServerSocket::connectionTerminated);
+    connect(
+        newConnSocket, &QTcpSocket::readyRead,
+        this, &TcpServerSocket::readFromSocket);
+    connect(
+        newConnSocket, &QTcpSocket::errorOccurred,
+        this, &TcpServerSocket::socketErrorOccurred);      
+}
+
+bool TcpServerSocket::connectionsLimitReached() const
+{
+    return (0U < m_maxConnections) && (m_maxConnections <= m_connections.size());
+}
+
+void TcpServerSocket::updateConnectionProps(ConnectionInfo& info)
+{
+    // Shared by all the data chunks of the connection
+    info.m_recvProps.clear();
+    info.m_recvProps.insert(tcpFromProp(), info.m_stats.m_endpoint);
+    info.m_recvProps.insert(tcpToProp(), m_localEndpoint);
+
+    info.m_sendProps.clear();
+    info.m_sendProps.insert(tcpFromProp(), m_localEndpoint);
+    info.m_sendProps.insert(tcpToProp(), info.m_stats.m_endpoint);
+}
+
+const QVariantMap& TcpServerSocket::broadcastProps()
+{
+    if (m_broadcastPropsValid) {
+        return m_broadcastProps;
+    }
+
+    QVariantList toList;
+    toList.reserve(static_cast<int>(m_connections.size()));
+    for (auto& elem : m_connections) {
+        toList.append(elem.second.m_stats.m_endpoint);
+    }
+
+    m_broadcastProps.clear();
+    m_broadcastProps.insert(tcpFromProp(), m_localEndpoint);
+    m_broadcastProps.insert(tcpToProp(), toList);
+    m_broadcastPropsValid = true;
+    return m_broadcastProps;
+}
+
+QString TcpServerSocket::targetEndpoint(const ToolsDataInfo& dataInfo) const
+{
+    // The list of endpoints (previous broadcast) or the local endpoint (received message) mean broadcast
+    auto toVar = dataInfo.m_extraProperties.value(tcpToProp());
+    if (toVar.userType() != qMetaTypeId<QString>()) {
+        return QString();
+    }
+
+    auto to = toVar.toString();
+    if (to == m_localEndpoint) {
+        return QString();
+    }
+
+    return to;
+}
+
+bool TcpServerSocket::resolveTarget(const ToolsDataInfo& dataInfo, ConnectionsMap::iterator& target)
+{
+    target = m_connections.end();
+
+    auto to = targetEndpoint(dataInfo);
+    if (!to.isEmpty()) {
+        auto* socket = m_endpoints.value(to);
+        if (socket == nullptr) {
+            reportError(tr("TCP/IP client %1 is not connected, data is not sent.").arg(to));
+            return false;
+        }
+
+        target = m_connections.find(socket);
+        assert(target != m_connections.end());
+        return true;
+    }
+
+    if (!m_replyToSender) {
+        return true;
+    }
+
+    if (m_lastSender == nullptr) {
+        static const QString NoSenderError(
+            tr("No TCP/IP client to reply to, data is not sent."));
+        reportError(NoSenderError);
+        return false;
+    }
+
+    target = m_connections.find(m_lastSender);
+    assert(target != m_connections.end());
+    return true;
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
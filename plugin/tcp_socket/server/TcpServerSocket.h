@@ -19,10 +19,12 @@
 
 #include "cc_tools_qt/ToolsSocket.h"
 
+#include <QtCore/QHash>
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
 
-#include <list>
+#include <unordered_map>
+#include <vector>
 
 #ifdef CC_TOOLS_QT_DEFAULT_NETWORK_PORT
 #define TCP_SERVER_DEFAULT_PORT CC_TOOLS_QT_DEFAULT_NETWORK_PORT    
@@ -45,6 +47,17 @@ class TcpServerSocket : public cc_tools_qt::ToolsSocket
 public:
     using PortType = unsigned short;
 
+    struct ConnectionStats
+    {
+        QString m_endpoint;
+        unsigned long long m_rxBytes = 0U;
+        unsigned long long m_rxCount = 0U;
+        unsigned long long m_txBytes = 0U;
+        unsigned long long m_txCount = 0U;
+    };
+
+    using ConnectionsStatsList = std::vector<ConnectionStats>;
+
     TcpServerSocket();
     ~TcpServerSocket() noexcept;
 
@@ -58,6 +71,33 @@ public:
         return m_port;
     }
 
+    // 0 means unlimited
+    void setMaxConnections(unsigned value);
+
+    unsigned getMaxConnections() const
+    {
+        return m_maxConnections;
+    }
+
+    // Send to the client the last data was received from rather than
+    // to all of them, unless "tcp.to" specifies the client.
+    void setReplyToSender(bool value)
+    {
+        m_replyToSender = value;
+    }
+
+    bool getReplyToSender() const
+    {
+        return m_replyToSender;
+    }
+
+    std::size_t connectionsCount() const
+    {
+        return m_connections.size();
+    }
+
+    ConnectionsStatsList connectionsStats() const;
+
 signals:
     void sigConfigChanged();    
 
@@ -65,6 +105,8 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(ToolsDataInfoPtr dataPtr) override;
+    virtual void sendDataListImpl(const QList<ToolsDataInfoPtr>& dataList) override;
+    virtual unsigned long long sendBacklogImpl() const override;
     virtual unsigned connectionPropertiesImpl() const override;
     virtual void applyInterPluginConfigImpl(const QVariantMap& props) override;     
 
@@ -76,9 +118,38 @@ private slots:
     void acceptErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    using StreamId = ToolsDataInfo::StreamId;
+
+    struct ConnectionInfo
+    {
+        StreamId m_streamId = ToolsDataInfo::DefaultStreamId;
+        ConnectionStats m_stats;
+        QVariantMap m_recvProps;
+        QVariantMap m_sendProps;
+    };
+
+    using ConnectionsMap = std::unordered_map<QTcpSocket*, ConnectionInfo>;
+    using EndpointsMap = QHash<QString, QTcpSocket*>;
+
+    void acceptConnections();
+    void addConnection(QTcpSocket* socket);
+    bool connectionsLimitReached() const;
+    void updateConnectionProps(ConnectionInfo& info);
+    const QVariantMap& broadcastProps();
+    QString targetEndpoint(const ToolsDataInfo& dataInfo) const;
+    bool resolveTarget(const ToolsDataInfo& dataInfo, ConnectionsMap::iterator& target);
+
     static const PortType DefaultPort = TCP_SERVER_DEFAULT_PORT;
     PortType m_port = DefaultPort;
-    std::list<QTcpSocket*> m_sockets;
+    unsigned m_maxConnections = 0U;
+    ConnectionsMap m_connections;
+    EndpointsMap m_endpoints;
+    QTcpSocket* m_lastSender = nullptr;
+    bool m_replyToSender = false;
+    StreamId m_nextStreamId = ToolsDataInfo::DefaultStreamId;
+    QString m_localEndpoint;
+    QVariantMap m_broadcastProps;
+    bool m_broadcastPropsValid = false;
     QTcpServer m_server;
 };
 
@@ -37,6 +37,8 @@ TcpServerSocketConfigWidget::TcpServerSocketConfigWidget(
         1,
         static_cast<int>(std::numeric_limits<PortType>::max()));
 
+    m_ui.m_maxConnectionsSpinBox->setRange(0, std::numeric_limits<int>::max());
+
     refresh();
 
     connect(
@@ -46,6 +48,14 @@ TcpServerSocketConfigWidget::TcpServerSocketConfigWidget(
     connect(
         m_ui.m_portSpinBox, qOverload<int>(&QSpinBox::valueChanged),
         this, &TcpServerSocketConfigWidget::portValueChanged);
+
+    connect(
+        m_ui.m_maxConnectionsSpinBox, qOverload<int>(&QSpinBox::valueChanged),
+        this, &TcpServerSocketConfigWidget::maxConnectionsValueChanged);
+
+    connect(
+        m_ui.m_replyToSenderCheckBox, &QCheckBox::toggled,
+        this, &TcpServerSocketConfigWidget::replyToSenderToggled);
 }
 
 TcpServerSocketConfigWidget::~TcpServerSocketConfigWidget() noexcept = default;
@@ -54,6 +64,11 @@ void TcpServerSocketConfigWidget::refresh()
 {
     m_ui.m_portSpinBox->setValue(
         static_cast<int>(m_socket.getPort()));
+
+    m_ui.m_maxConnectionsSpinBox->setValue(
+        static_cast<int>(m_socket.getMaxConnections()));
+
+    m_ui.m_replyToSenderCheckBox->setChecked(m_socket.getReplyToSender());
 }
 
 void TcpServerSocketConfigWidget::portValueChanged(int value)
@@ -61,6 +76,16 @@ void TcpServerSocketConfigWidget::portValueChanged(int value)
     m_socket.setPort(static_cast<PortType>(value));
 }
 
+void TcpServerSocketConfigWidget::maxConnectionsValueChanged(int value)
+{
+    m_socket.setMaxConnections(static_cast<unsigned>(value));
+}
+
+void TcpServerSocketConfigWidget::replyToSenderToggled(bool checked)
+{
+    m_socket.setReplyToSender(checked);
+}
+
 }  // namespace plugin
 
 }  // namespace cc_tools_qt
@@ -46,6 +46,8 @@ public:
 private slots:
     void refresh();
     void portValueChanged(int value);
+    void maxConnectionsValueChanged(int value);
+    void replyToSenderToggled(bool checked);
 
 private:
     TcpServerSocket& m_socket;
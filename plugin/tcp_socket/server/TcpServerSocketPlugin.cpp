@@ -34,6 +34,8 @@ namespace
 
 const QString MainConfigKey("cc_tcp_server_socket");
 const QString PortSubKey("port");
+const QString MaxConnectionsSubKey("max_connections");
+const QString ReplyToSenderSubKey("reply_to_sender");
 
 }  // namespace
 
@@ -50,6 +52,8 @@ void TcpServerSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
 
     QVariantMap subConfig;
     subConfig.insert(PortSubKey, QVariant::fromValue(m_socket->getPort()));
+    subConfig.insert(MaxConnectionsSubKey, QVariant::fromValue(m_socket->getMaxConnections()));
+    subConfig.insert(ReplyToSenderSubKey, QVariant::fromValue(m_socket->getReplyToSender()));
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -72,6 +76,16 @@ void TcpServerSocketPlugin::reconfigureImpl(const QVariantMap& config)
     createSocketIfNeeded();
 
     m_socket->setPort(port);
+
+    auto maxConnectionsVar = subConfig.value(MaxConnectionsSubKey);
+    if (maxConnectionsVar.isValid() && maxConnectionsVar.canConvert<unsigned>()) {
+        m_socket->setMaxConnections(maxConnectionsVar.value<unsigned>());
+    }
+
+    auto replyToSenderVar = subConfig.value(ReplyToSenderSubKey);
+    if (replyToSenderVar.isValid() && replyToSenderVar.canConvert<bool>()) {
+        m_socket->setReplyToSender(replyToSenderVar.value<bool>());
+    }
 }
 
 void TcpServerSocketPlugin::applyInterPluginConfigImpl(const QVariantMap& props)
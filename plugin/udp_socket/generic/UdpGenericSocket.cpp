@@ -169,6 +169,7 @@ bool UdpGenericSocket::socketConnectImpl()
 
     assert(!m_socket.isOpen());
     m_running = true;
+    clearEndpointProps();
 
     do {
         if (m_localPort == 0) {
@@ -217,16 +218,12 @@ void UdpGenericSocket::socketDisconnectImpl()
     m_socket.close();
     m_running = false;
     m_socket.blockSignals(false);
+    clearEndpointProps();
 }
 
 void UdpGenericSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
 {
     assert(dataPtr);
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    dataPtr->m_extraProperties.insert(udpFromProp(), from);
-
     do {
         bool broadcastRequested = false;
         static const QString* BroadcastProps[] = {
@@ -299,10 +296,14 @@ void UdpGenericSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
             writtenCount += static_cast<std::size_t>(count);
         }
 
+        QString from =
+            m_socket.localAddress().toString() + ':' +
+                        QString("%1").arg(m_socket.localPort());
         QString to =
             QHostAddress(QHostAddress::Broadcast).toString() + ':' +
                         QString("%1").arg(m_port);
 
+        dataPtr->m_extraProperties.insert(udpFromProp(), from);
         dataPtr->m_extraProperties.insert(udpToProp(), to);
         return;
     } while (false);
@@ -329,11 +330,7 @@ void UdpGenericSocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         writtenCount += static_cast<std::size_t>(count);
     }
 
-    QString to =
-        m_socket.peerAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.peerPort());
-
-    dataPtr->m_extraProperties.insert(udpToProp(), to);
+    dataPtr->mergeExtraProperties(sendProps());
 }
 
 void UdpGenericSocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -416,18 +413,11 @@ void UdpGenericSocket::readFromSocket()
             &senderAddress,
             &senderPort);
 
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_socket.localAddress().toString() + ':' +
-                        QString("%1").arg(m_socket.localPort());
-
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
+        dataPtr->m_extraProperties = recvProps(senderAddress, senderPort);
         reportDataReceived(std::move(dataPtr));
 
         if (m_socket.state() != QUdpSocket::ConnectedState) {
+            clearEndpointProps();
             m_socket.connectToHost(senderAddress, senderPort);
             m_socket.waitForConnected();
             assert(m_socket.isOpen());
@@ -450,6 +440,54 @@ bool UdpGenericSocket::bindSocket(QUdpSocket& socket)
     return socket.open(QUdpSocket::ReadWrite);
 }
 
+const QVariantMap& UdpGenericSocket::recvProps(const QHostAddress& senderAddress, PortType senderPort)
+{
+    // The datagrams usually come from the same sender, reuse the properties
+    if ((!m_recvProps.m_props.isEmpty()) &&
+        (m_recvProps.m_port == senderPort) &&
+        (m_recvProps.m_addr == senderAddress)) {
+        return m_recvProps.m_props;
+    }
+
+    QString from =
+        senderAddress.toString() + ':' +
+                    QString("%1").arg(senderPort);
+    QString to =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+
+    m_recvProps.m_addr = senderAddress;
+    m_recvProps.m_port = senderPort;
+    m_recvProps.m_props.clear();
+    m_recvProps.m_props.insert(udpFromProp(), from);
+    m_recvProps.m_props.insert(udpToProp(), to);
+    return m_recvProps.m_props;
+}
+
+const QVariantMap& UdpGenericSocket::sendProps()
+{
+    if (!m_sendProps.isEmpty()) {
+        return m_sendProps;
+    }
+
+    QString from =
+        m_socket.localAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.localPort());
+    QString to =
+        m_socket.peerAddress().toString() + ':' +
+                    QString("%1").arg(m_socket.peerPort());
+
+    m_sendProps.insert(udpFromProp(), from);
+    m_sendProps.insert(udpToProp(), to);
+    return m_sendProps;
+}
+
+void UdpGenericSocket::clearEndpointProps()
+{
+    m_recvProps.m_props.clear();
+    m_sendProps.clear();
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
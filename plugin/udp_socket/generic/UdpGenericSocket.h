@@ -99,7 +99,17 @@ private slots:
     void socketErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    struct EndpointProps
+    {
+        QHostAddress m_addr;
+        PortType m_port = 0;
+        QVariantMap m_props;
+    };
+
     bool bindSocket(QUdpSocket& socket);
+    const QVariantMap& recvProps(const QHostAddress& senderAddress, PortType senderPort);
+    const QVariantMap& sendProps();
+    void clearEndpointProps();
 
     static const PortType DefaultPort = UDP_GENERIC_DEFAULT_PORT;
 
@@ -108,6 +118,8 @@ private:
     PortType m_localPort = 0;
     QString m_broadcastMask = "255.255.255.255";
     QUdpSocket m_socket;
+    EndpointProps m_recvProps;
+    QVariantMap m_sendProps;
     int m_defaultTtl = 0;
     bool m_running = false;
 };
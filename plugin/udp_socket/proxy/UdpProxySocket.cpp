@@ -117,6 +117,7 @@ bool UdpProxySocket::socketConnectImpl()
         return false;
     }    
 
+    clearEndpointProps();
     if (!createListenSocket()) {
         m_listenSocket.reset();
         return false;
@@ -139,6 +140,7 @@ void UdpProxySocket::socketDisconnectImpl()
     m_listenSocket.reset();
     m_remoteSocket.reset();
     m_running = false;
+    clearEndpointProps();
 }
 
 void UdpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
@@ -148,13 +150,6 @@ void UdpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
     }
 
     assert(dataPtr);
-    assert(m_listenSocket);
-    QString from =
-        m_listenSocket->localAddress().toString() + ':' +
-                    QString("%1").arg(m_listenSocket->localPort());
-    dataPtr->m_extraProperties.insert(udpFromProp(), from);
-
-
     assert(m_listenSocket);
     if (!m_listenSocket->isOpen()) {
         return;
@@ -175,11 +170,7 @@ void UdpProxySocket::sendDataImpl(ToolsDataInfoPtr dataPtr)
         writtenCount += static_cast<std::size_t>(count);
     }
 
-    QString to =
-        m_listenSocket->peerAddress().toString() + ':' +
-                    QString("%1").arg(m_listenSocket->peerPort());
-
-    dataPtr->m_extraProperties.insert(udpToProp(), to);
+    dataPtr->mergeExtraProperties(sendProps());
 }
 
 void UdpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
@@ -232,6 +223,7 @@ void UdpProxySocket::applyInterPluginConfigImpl(const QVariantMap& props)
 void UdpProxySocket::listenSocketDisconnected()
 {
     reportDisconnected();
+    clearEndpointProps();
     if (m_remoteSocket) {
         m_remoteSocket->blockSignals(true);
     }
@@ -264,28 +256,19 @@ void UdpProxySocket::readFromListenSocket()
         }
 
         if (m_listenSocket->state() != QUdpSocket::ConnectedState) {
+            clearEndpointProps();
             m_listenSocket->connectToHost(senderAddress, senderPort);
             if (!m_listenSocket->waitForConnected(100)) {
                 std::cerr << "WARNING: cannot connect to the initiating UDP socket." << std::endl;
             }
         }
 
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_listenSocket->localAddress().toString() + ':' +
-                        QString("%1").arg(m_listenSocket->localPort());
-
         if (m_remoteSocket) {
             m_remoteSocket->write(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<qint64>(dataPtr->m_data.size()));
-
-            to = m_remoteSocket->peerAddress().toString() + ':' +
-                        QString("%1").arg(m_remoteSocket->peerPort());
         }                          
 
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
+        dataPtr->m_extraProperties =
+            recvProps(m_listenRecvProps, senderAddress, senderPort, *m_listenSocket, m_remoteSocket.get());
         reportDataReceived(std::move(dataPtr));
     }    
 }
@@ -300,6 +283,7 @@ void UdpProxySocket::remoteSocketDisconnected()
 {
     assert(m_remoteSocket);
     reportDisconnected();
+    clearEndpointProps();
 
     if (m_listenSocket) {
         m_remoteSocket->blockSignals(true);
@@ -330,22 +314,12 @@ void UdpProxySocket::readFromRemoteSocket()
             continue;
         }            
 
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_remoteSocket->localAddress().toString() + ':' +
-                        QString("%1").arg(m_remoteSocket->localPort());
-
         if (m_listenSocket) {
             m_listenSocket->write(reinterpret_cast<const char*>(dataPtr->m_data.data()), static_cast<qint64>(dataPtr->m_data.size()));
-
-            to = m_listenSocket->peerAddress().toString() + ':' +
-                        QString("%1").arg(m_listenSocket->peerPort());
         }            
 
-        dataPtr->m_extraProperties.insert(udpFromProp(), from);
-        dataPtr->m_extraProperties.insert(udpToProp(), to);
+        dataPtr->m_extraProperties =
+            recvProps(m_remoteRecvProps, senderAddress, senderPort, *m_remoteSocket, m_listenSocket.get());
         reportDataReceived(std::move(dataPtr));
     }    
 }
@@ -390,6 +364,7 @@ void UdpProxySocket::createRemoteSocketIfNeeded()
     }
 
     m_remoteSocket = std::make_unique<QUdpSocket>();
+    clearEndpointProps();
 
     connect(
         m_remoteSocket.get(), &QUdpSocket::disconnected,
@@ -409,6 +384,66 @@ void UdpProxySocket::createRemoteSocketIfNeeded()
     }
 }
 
+const QVariantMap& UdpProxySocket::recvProps(
+    EndpointProps& cache,
+    const QHostAddress& senderAddress,
+    PortType senderPort,
+    const QUdpSocket& recvSocket,
+    const QUdpSocket* forwardSocket)
+{
+    // The datagrams usually come from the same sender, reuse the properties
+    if ((!cache.m_props.isEmpty()) &&
+        (cache.m_port == senderPort) &&
+        (cache.m_addr == senderAddress)) {
+        return cache.m_props;
+    }
+
+    QString from =
+        senderAddress.toString() + ':' +
+                    QString("%1").arg(senderPort);
+    QString to =
+        recvSocket.localAddress().toString() + ':' +
+                    QString("%1").arg(recvSocket.localPort());
+
+    if (forwardSocket != nullptr) {
+        to = forwardSocket->peerAddress().toString() + ':' +
+                    QString("%1").arg(forwardSocket->peerPort());
+    }
+
+    cache.m_addr = senderAddress;
+    cache.m_port = senderPort;
+    cache.m_props.clear();
+    cache.m_props.insert(udpFromProp(), from);
+    cache.m_props.insert(udpToProp(), to);
+    return cache.m_props;
+}
+
+const QVariantMap& UdpProxySocket::sendProps()
+{
+    if (!m_sendProps.isEmpty()) {
+        return m_sendProps;
+    }
+
+    assert(m_listenSocket);
+    QString from =
+        m_listenSocket->localAddress().toString() + ':' +
+                    QString("%1").arg(m_listenSocket->localPort());
+    QString to =
+        m_listenSocket->peerAddress().toString() + ':' +
+                    QString("%1").arg(m_listenSocket->peerPort());
+
+    m_sendProps.insert(udpFromProp(), from);
+    m_sendProps.insert(udpToProp(), to);
+    return m_sendProps;
+}
+
+void UdpProxySocket::clearEndpointProps()
+{
+    m_listenRecvProps.m_props.clear();
+    m_remoteRecvProps.m_props.clear();
+    m_sendProps.clear();
+}
+
 } // namespace plugin
 
 } // namespace cc_tools_qt
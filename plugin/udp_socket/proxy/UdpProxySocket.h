@@ -96,9 +96,24 @@ private slots:
 private:
     using SocketPtr = std::unique_ptr<QUdpSocket>;
 
+    struct EndpointProps
+    {
+        QHostAddress m_addr;
+        PortType m_port = 0;
+        QVariantMap m_props;
+    };
+
     void readData(QUdpSocket& socket);
     bool createListenSocket();
     void createRemoteSocketIfNeeded();
+    const QVariantMap& recvProps(
+        EndpointProps& cache,
+        const QHostAddress& senderAddress,
+        PortType senderPort,
+        const QUdpSocket& recvSocket,
+        const QUdpSocket* forwardSocket);
+    const QVariantMap& sendProps();
+    void clearEndpointProps();
 
     static const PortType DefaultPort = UDP_PROXY_DEFAULT_PORT;
 
@@ -107,6 +122,9 @@ private:
     PortType m_localPort = DefaultPort + 1;
     SocketPtr m_listenSocket;
     SocketPtr m_remoteSocket;
+    EndpointProps m_listenRecvProps;
+    EndpointProps m_remoteRecvProps;
+    QVariantMap m_sendProps;
     bool m_running = false;
 };
 